@@ -43,11 +43,22 @@ public:
                                          BranchIslandFactory &PBrIslandFactory,
                                          GNULDBackend &PBackend);
 
+  /// isStubNeeded - return true if create() would need a branch island for
+  /// PReloc in the current layout. This does not modify any state and may be
+  /// called concurrently.
+  bool isStubNeeded(Relocation &PReloc, Module &PModule,
+                    GNULDBackend &PBackend) const;
+
   void registerStub(Stub *PStub);
 
   StubVector &getAllStubs() { return Stubs; }
 
 private:
+  /// findStub - return the stub to use for PReloc, or nullptr if the target
+  /// is reachable without one. TargetSymbolValue is set to the branch target.
+  Stub *findStub(Relocation &PReloc, Module &PModule, GNULDBackend &PBackend,
+                 int64_t &TargetSymbolValue) const;
+
   std::vector<Stub *> Stubs;
   std::mutex Mutex;
 };
@@ -600,6 +600,11 @@ public:
 
   bool mergeStrings() const { return BMergeStrings; }
 
+  // --merge-strings=tail
+  void setTailMergeStrings(bool TailMerge) { BTailMergeStrings = TailMerge; }
+
+  bool tailMergeStrings() const { return BTailMergeStrings; }
+
   void setEmitRelocs(bool EmitRelocs) {
     BEmitRelocs = EmitRelocs;
     ;
@@ -1031,6 +1036,20 @@ public:
     return ThinArchiveRuleMatchingCompat;
   }
 
+  // --rule-match-cache=<dir> support
+  void setRuleMatchingCacheDir(llvm::StringRef Dir) {
+    RuleMatchingCacheDir = Dir.str();
+  }
+
+  llvm::StringRef getRuleMatchingCacheDir() const {
+    return RuleMatchingCacheDir;
+  }
+
+  // --apply-relocations-in-place support
+  void setApplyRelocationsInPlace() { BApplyRelocationsInPlace = true; }
+
+  bool applyRelocationsInPlace() const { return BApplyRelocationsInPlace; }
+
   // --sort-common support
   void setSortCommon() { SortCommon = SortCommonSymbols::DescendingAlignment; }
 
@@ -1189,6 +1208,7 @@ private:
   bool NoGnuStack = false;           //--nognustack
   bool BNoTrampolines = false;       //--no-trampolines
   bool BMergeStrings = true;         //--merge-strings
+  bool BTailMergeStrings = false;    //--merge-strings=tail
   bool BEmitRelocs = false;          //--emit-relocs
   bool BEmitGNUCompatRelocs = false; // --emit-gnu-compat-relocs
   bool BCref = false;                // --cref
@@ -1318,6 +1338,8 @@ private:
   bool BKeepLabels = false;                // --keep-labels (RISC-V)
   bool BEnableOverlapChecks = true; // --check-sections/--no-check-sections
   bool ThinArchiveRuleMatchingCompat = false;
+  std::string RuleMatchingCacheDir; // --rule-match-cache
+  bool BApplyRelocationsInPlace = false; // --apply-relocations-in-place
   bool BPrintMemoryUsage = false;              // --print-memory-usage
   std::optional<SortCommonSymbols> SortCommon; // --sort-common
   std::optional<SortSection> SortSection;      // --sort-section
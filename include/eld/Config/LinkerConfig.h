@@ -68,7 +68,12 @@ public:
     CreateOutputSections = 0x10,
     ApplyRelocations = 0x20,
     LinkerRelaxation = 0x40,
-    AllThreads = 0x1 | 0x2 | 0x4 | 0x8 | 0x10 | 0x20 | 0x40 | 0x80,
+    ReadInputs = 0x80,
+    MarkLiveSections = 0x100,
+    MergeStrings = 0x200,
+    EhFrame = 0x400,
+    AllThreads = 0x1 | 0x2 | 0x4 | 0x8 | 0x10 | 0x20 | 0x40 | 0x80 | 0x100 |
+                 0x200 | 0x400,
   };
 
   enum SymDefStyle { Default, Provide, UnknownSymDefStyle };
@@ -169,6 +174,22 @@ public:
     return EnableThreads & LinkerConfig::LinkerRelaxation;
   }
 
+  bool isReadInputsMultiThreaded() const {
+    return EnableThreads & LinkerConfig::ReadInputs;
+  }
+
+  bool isMarkLiveSectionsMultiThreaded() const {
+    return EnableThreads & LinkerConfig::MarkLiveSections;
+  }
+
+  bool isMergeStringsMultiThreaded() const {
+    return EnableThreads & LinkerConfig::MergeStrings;
+  }
+
+  bool isEhFrameMultiThreaded() const {
+    return EnableThreads & LinkerConfig::EhFrame;
+  }
+
   void setThreadOptions(uint32_t EnableThreadsOpt) {
     EnableThreads = NoThreads;
     if (EnableThreadsOpt & AssignOutputSections)
@@ -185,6 +206,14 @@ public:
       EnableThreads |= ApplyRelocations;
     if (EnableThreadsOpt & LinkerRelaxation)
       EnableThreads |= LinkerRelaxation;
+    if (EnableThreadsOpt & ReadInputs)
+      EnableThreads |= ReadInputs;
+    if (EnableThreadsOpt & MarkLiveSections)
+      EnableThreads |= MarkLiveSections;
+    if (EnableThreadsOpt & MergeStrings)
+      EnableThreads |= MergeStrings;
+    if (EnableThreadsOpt & EhFrame)
+      EnableThreads |= EhFrame;
   }
 
   void disableThreadOptions(uint32_t ThreadOptions) {
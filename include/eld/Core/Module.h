@@ -36,6 +36,7 @@
 #include "llvm/ADT/StringRef.h"
 #include "llvm/ADT/StringSet.h"
 #include <array>
+#include <atomic>
 #include <climits>
 #include <mutex>
 #include <set>
@@ -538,6 +539,25 @@ public:
   bool getRelocationData(const eld::Relocation *, uint64_t &);
   bool getRelocationDataForSync(const eld::Relocation *, uint64_t &);
 
+  /// With --apply-relocations-in-place, syncRelocations applies every
+  /// relocation that is not recorded as applied here. relocation() records
+  /// the relocations that plugins have read or replaced so far and applies
+  /// them itself. Relocations read afterwards are applied on first use.
+  void recordInspectedRelocationsAsApplied();
+  /// Returns false if the relocation was already recorded as applied.
+  bool markRelocationApplied(const eld::Relocation *);
+  /// Not locked: only called once no plugin can mark relocations anymore.
+  bool isRelocationApplied(const eld::Relocation *R) const {
+    return AppliedRelocations.count(R);
+  }
+  bool hasAppliedRelocations() const { return !AppliedRelocations.empty(); }
+
+  // ------------- Symbol and relocation edits made by plugins -------------
+  /// Bumped by every plugin API that adds, removes or retargets symbols and
+  /// relocations, so that state derived from them can be invalidated.
+  void recordPluginEdit() { ++PluginEditGeneration; }
+  uint64_t getPluginEditGeneration() const { return PluginEditGeneration; }
+
   void addReferencedSymbol(Section &, ResolveInfo &);
 
   const ReferencedSymbols &getBitcodeReferencedSymbols() const {
@@ -683,6 +703,10 @@ private:
   std::unordered_set<std::string> VisitedAssignments;
   // ----------------- Relocation Data set by plugins ------------------
   std::unordered_map<const eld::Relocation *, uint64_t> RelocationData;
+  std::unordered_set<const eld::Relocation *> InspectedRelocations;
+  std::unordered_set<const eld::Relocation *> AppliedRelocations;
+  // ----------------- Symbol/relocation edits made by plugins --------
+  std::atomic<uint64_t> PluginEditGeneration{0};
   // ----------------- Section references set by plugins --------------
   ReferencedSymbols BitcodeReferencedSymbols;
   // ----------------- Mutex guard -----------------------------------
@@ -52,7 +52,9 @@ public:
   virtual void dump(llvm::raw_ostream &OS) override;
 
 private:
-  std::vector<FdeData> getFdeData(uint8_t *D, DiagnosticEngine *DiagEngine);
+  /// Returns the binary search table entries sorted by PC. The PCs are read
+  /// from the .eh_frame contents after the relocations are applied.
+  std::vector<FdeData> getFdeData(uint8_t *D, Module &M);
 
   uint64_t readFdeAddr(uint8_t *Buf, int Size, DiagnosticEngine *DiagEngine);
 
@@ -0,0 +1,45 @@
+//===- MergeConstantFragment.h---------------------------------------------===//
+// Part of the eld Project, under the BSD License
+// See https://github.com/qualcomm/eld/LICENSE.txt for license information.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+#ifndef ELD_FRAGMENT_MERGECONSTANTFRAGMENT_H
+#define ELD_FRAGMENT_MERGECONSTANTFRAGMENT_H
+
+#include "eld/Fragment/MergeStringFragment.h"
+
+namespace eld {
+
+/// MergeConstantFragment is a MergeStringFragment of a section that holds
+/// fixed-size constants (SHF_MERGE without SHF_STRINGS), such as
+/// .rodata.cst8. The section is split into entries of sh_entsize bytes, which
+/// are merged with identical entries destined for the same output section
+/// in the same way as strings.
+///
+/// Entries are only merged with entries of the same size and alignment; they
+/// are never merged with strings, nor tail merged.
+class MergeConstantFragment : public MergeStringFragment {
+public:
+  MergeConstantFragment(ELFSection *O);
+
+  bool readConstants(LinkerConfig &Config);
+
+  uint32_t getEntrySize() const { return EntrySize; }
+
+  static bool classof(const Fragment *F) {
+    return F->getKind() == Fragment::MergeConstant;
+  }
+
+private:
+  void addConstant(LinkerConfig &Config, llvm::StringRef Constant,
+                   uint64_t Offset);
+
+private:
+  uint32_t EntrySize;
+  /// Salt of the hash of the entries, which is unique per entry alignment.
+  uint32_t Salt;
+};
+
+} // namespace eld
+
+#endif
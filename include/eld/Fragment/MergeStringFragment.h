@@ -7,7 +7,10 @@
 #define ELD_FRAGMENT_MERGESTRINGFRAGMENT_H
 
 #include "eld/Fragment/Fragment.h"
+#include "llvm/ADT/ArrayRef.h"
 #include "llvm/ADT/StringRef.h"
+#include "llvm/Support/xxhash.h"
+#include <string>
 
 namespace eld {
 
@@ -31,22 +34,45 @@ struct MergeableString {
   uint32_t InputOffset;
   uint32_t OutputOffset;
   bool Exclude;
+  /// Hash of String, see hash(). It is computed before the string is created,
+  /// on the thread pool when the section is split by the reader, so that
+  /// strings can be merged without hashing them again.
+  uint32_t Hash;
   MergeableString(MergeStringFragment *F, llvm::StringRef S, uint32_t I,
-                  uint32_t O, bool E)
-      : Fragment(F), String(S), InputOffset(I), OutputOffset(O), Exclude(E) {}
+                  uint32_t O, bool E, uint32_t H)
+      : Fragment(F), String(S), InputOffset(I), OutputOffset(O), Exclude(E),
+        Hash(H) {}
+  /// Strings are only merged if their hashes are equal, so a non-zero Salt
+  /// keeps strings with the same bytes apart, see MergeConstantFragment.
+  static uint32_t hash(llvm::StringRef S, uint32_t Salt = 0) {
+    return static_cast<uint32_t>(llvm::xxh3_64bits(S)) ^ Salt;
+  }
   void exclude() { Exclude = true; }
   uint64_t size() const { return String.size(); }
+  /// Returns the offset of S in this string. S is either identical to this
+  /// string or, with tail merging, a suffix of it.
+  uint32_t getSuffixOffset(const MergeableString *S) const {
+    return size() - S->size();
+  }
   bool hasOutputOffset() const {
     return OutputOffset != std::numeric_limits<uint32_t>::max();
   }
   bool isAlloc() const;
+  /// Returns true if this is a fixed-size constant of a MergeConstantFragment
+  /// rather than a null terminated string.
+  bool isConstant() const;
+  /// Returns the contents in a printable form.
+  std::string getDisplayString() const;
 };
 
 /// MergeStringFrgament is a Fragment that manages MergeableStrings of a
 /// LDFileFormat::MergeStr input section.
 class MergeStringFragment : public Fragment {
+protected:
   std::vector<MergeableString *> Strings;
 
+  MergeStringFragment(Fragment::Type Kind, ELFSection *O, uint32_t Align);
+
 public:
   MergeStringFragment(ELFSection *O);
 
@@ -60,8 +86,14 @@ public:
 
   bool readStrings(LinkerConfig &Config);
 
+  /// Same as readStrings, but uses the sizes and hashes of the null terminated
+  /// strings of the section, computed ahead of time by the reader.
+  bool readStrings(LinkerConfig &Config, llvm::ArrayRef<uint32_t> StringSizes,
+                   llvm::ArrayRef<uint32_t> StringHashes);
+
   static bool classof(const Fragment *F) {
-    return F->getKind() == Fragment::MergeString;
+    return F->getKind() == Fragment::MergeString ||
+           F->getKind() == Fragment::MergeConstant;
   }
 
   size_t size() const override;
@@ -81,6 +113,9 @@ public:
   void setOffset(uint32_t Offset) override;
 
 private:
+  void addString(LinkerConfig &Config, llvm::StringRef String, uint64_t Offset,
+                 uint32_t Hash);
+
   /// After this fragment has been given an output offset this function will be
   /// called and set the output offset of every string owned by this fragment
   void assignOutputOffsets();
@@ -41,6 +41,22 @@ public:
   void deleteInstruction(uint32_t Offset, uint32_t Size);
   void addRequiredNops(uint32_t Offset, uint32_t NumNopsToAdd);
 
+  /// Record that \p Size bytes at \p Offset are to be deleted. Offsets are
+  /// those of the region before any pending deletion; bytes, relocations and
+  /// symbols stay untouched until applyPendingDeletions is called.
+  void addPendingDeletion(uint32_t Offset, uint32_t Size);
+
+  bool hasPendingDeletions() const { return !PendingDeletions.empty(); }
+
+  /// Offset that \p Offset will have once pending deletions are applied.
+  uint32_t getRelaxedOffset(uint32_t Offset) const;
+
+  /// Number of bytes pending deletion at offsets in [Begin, End).
+  uint32_t getPendingDeletedBytes(uint32_t Begin, uint32_t End) const;
+
+  /// Fix up relocations and symbols and compact the region in a single sweep.
+  void applyPendingDeletions();
+
   size_t size() const override;
 
   virtual eld::Expected<void> emit(MemoryRegion &Mr, Module &M) override;
@@ -53,6 +69,11 @@ protected:
   std::vector<ResolveInfo *> Symbols;
   const char *Data;
   size_t Size;
+  /// Pending deletions as (offset, size), sorted by offset.
+  std::vector<std::pair<uint32_t, uint32_t>> PendingDeletions;
+  /// DeletedBefore[I] is the number of bytes deleted by the first I entries
+  /// of PendingDeletions.
+  std::vector<uint32_t> DeletedBefore;
 };
 
 } // namespace eld
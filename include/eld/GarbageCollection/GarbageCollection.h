@@ -18,6 +18,7 @@
 #include "llvm/ADT/DenseSet.h"
 #include <queue>
 #include <set>
+#include <tuple>
 #include <vector>
 
 namespace eld {
@@ -64,6 +65,17 @@ public:
     // For bit code sections
     void findReachedBitCodeSectionsAndSymbols(Module &CurModule);
 
+    /// addBitCodeReferences - add the references from the bitcode section
+    /// pFrom to the symbols pSyms
+    void addBitCodeReferences(Module &CurModule, Section &From,
+                              const std::vector<ResolveInfo *> &Syms);
+
+    /// getReachedSections - get the map of all the sections to the list of
+    /// sections which they can reach directly
+    const llvm::DenseMap<Section *, SectionListTy> &getReachedSections() const {
+      return ReachedSections;
+    }
+
     void addToWorkQ(Section *W) { InputBitcodeSections.push(W); }
 
   private:
@@ -85,16 +97,52 @@ public:
                     Module &CurModule);
   ~GarbageCollection();
 
-  /// run - do garbage collection
+  /// run - do garbage collection. If the reachability map built by an
+  /// earlier run is still valid, only the references and entry sections added
+  /// since that run are walked.
   bool run(const std::string &Phase, bool CommonSectionsOnly = false);
 
   // is section part of garbage collection ?
   bool mayProcessGC(ELFSection &CurSection);
 
 private:
+  typedef std::queue<std::pair<Section *, Section *>> WorkListTy;
+
+  /// Discards the state of earlier runs, and builds the reachability map.
+  void buildReachedSections();
+
+  /// Returns the number of input files, input relocations and relocations
+  /// retargeted by plugins that the reachability map is built from.
+  std::tuple<size_t, size_t, uint64_t> getReachabilityInputs() const;
+
+  /// Returns true if the state of the earlier run can be updated instead of
+  /// being built again.
+  bool canRunIncrementally() const;
+
+  /// Adds the references added with LinkerWrapper::addReferencedSymbol since
+  /// the earlier run to the reachability map. The new references from
+  /// referenced sections are added to WorkList.
+  void addNewReferencedSymbols(WorkListTy &WorkList);
+
   void setUpReachedSectionsAndSymbols();
   void findReferencedSectionsAndSymbols(SectionSetTy &PEntry,
                                         SectionSetTy &LiveSet);
+
+  /// Walks the reached sections breadth-first from each entry section, one
+  /// section at a time. This is used when the walk is traced.
+  void findReferencedSectionsSerial(SectionSetTy &PEntry,
+                                    SectionSetTy &LiveSet);
+
+  /// Builds a compact (CSR) copy of the reached sections graph, indexed by
+  /// dense section IDs, and walks it one frontier at a time using the module
+  /// thread pool. Liveness is tracked in atomic bitsets.
+  void findReferencedSectionsInParallel(SectionSetTy &PEntry,
+                                        SectionSetTy &LiveSet);
+
+  /// Walks the reached sections breadth-first from the sections in WorkList.
+  void walkReferencedSections(WorkListTy &WorkList,
+                              const SectionSetTy &EntrySections,
+                              SectionSetTy &LiveSet);
   bool getEntrySections(SectionSetTy &PEntry);
   void stripSections(SectionSetTy &S, bool CommonSectionsOnly);
   bool treatSymbolAsEntry(ResolveInfo *R) const;
@@ -112,6 +160,17 @@ private:
   /// m_ReferencedSections - a list of sections which can be reached from entry
   SectionListTy MReferencedSections;
 
+  // State kept for the incremental runs.
+  SectionSetTy MEntrySections;
+  SectionSetTy MLiveSet;
+  /// Number of references of each section in
+  /// Module::getBitcodeReferencedSymbols that have been added to the map.
+  llvm::DenseMap<const Section *, size_t> MNumSeenReferences;
+  std::tuple<size_t, size_t, uint64_t> MReachabilityInputs;
+  /// Module::getPluginEditGeneration when the reachability map was built.
+  uint64_t MPluginEditGeneration = 0;
+  bool MHasRun = false;
+
   LinkerConfig &ThisConfig;
   const GNULDBackend &MBackend;
   Module &ThisModule;
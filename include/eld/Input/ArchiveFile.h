@@ -18,6 +18,7 @@
 #include "llvm/ADT/DenseMap.h"
 #include <cstddef>
 #include <optional>
+#include <set>
 #include <vector>
 
 namespace eld {
@@ -136,7 +137,33 @@ public:
 
   ArchiveFileInfo *getArchiveFileInfo() const { return AFI; }
 
+  /// ------------------------Lazy Symbols ---------------------------
+  /// Returns true if the symbols of this archive have been added to the
+  /// NamePool as lazy symbols.
+  bool hasLazySymbols() const { return HasLazySymbols; }
+
+  /// Returns true if the lazy symbols were last added in the post LTO phase.
+  bool isLazySymbolsPostLTO() const { return LazySymbolsPostLTO; }
+
+  void setHasLazySymbols(bool IsPostLTOPhase) {
+    HasLazySymbols = true;
+    LazySymbolsPostLTO = IsPostLTOPhase;
+  }
+
+  /// Records that the NamePool entry of the symbol at PSymIdx has changed, and
+  /// the symbol needs to be considered again for inclusion.
+  void addPendingSymbol(uint32_t PSymIdx) { PendingSymbols.insert(PSymIdx); }
+
+  /// Symbol table indices, in symbol table order, that are pending inclusion
+  /// checks.
+  std::set<uint32_t> &getPendingSymbols() { return PendingSymbols; }
+
+  bool hasPendingSymbols() const { return !PendingSymbols.empty(); }
+
 private:
+  std::set<uint32_t> PendingSymbols;
+  bool HasLazySymbols = false;
+  bool LazySymbolsPostLTO = false;
   ArchiveFileInfo *AFI = nullptr;
   size_t ProcessedMemberCount = 0;
   bool BNoExport = false;
@@ -13,6 +13,8 @@
 namespace eld {
 
 class ELFSection;
+class Relocation;
+class ResolveInfo;
 class TimingSection;
 class RelocMap;
 
@@ -70,6 +72,50 @@ public:
 
   void populateDebugSections();
 
+  // --- Relocation scan support
+  //
+  // Relocations of different files are scanned concurrently. GOT and PLT
+  // entries are only requested on the file being scanned. Once the scan is
+  // done, GNULDBackend::mergeScannedEntries visits the files in input order
+  // and creates each entry for the first file that requested it, so that the
+  // layout of .got, .got.plt, .plt and the dynamic relocation sections does
+  // not depend on thread scheduling.
+
+  /// Request the GOT entries that relocation R, scanned as Type, needs.
+  void requestGOT(Relocation *R, uint32_t Type) {
+    RequestedGOTs.emplace_back(R, Type);
+  }
+
+  /// Request a PLT entry for R in the PLT of this file.
+  void requestPLT(ResolveInfo *R, bool IsIRelative) {
+    RequestedPLTs.emplace_back(R, IsIRelative);
+  }
+
+  /// Record that the relative dynamic relocation R was created for N.
+  void recordRelativeReloc(Relocation *R, const Relocation *N) {
+    RelativeRelocs.emplace_back(R, N);
+  }
+
+  const std::vector<std::pair<Relocation *, uint32_t>> &
+  getRequestedGOTs() const {
+    return RequestedGOTs;
+  }
+
+  const std::vector<std::pair<ResolveInfo *, bool>> &getRequestedPLTs() const {
+    return RequestedPLTs;
+  }
+
+  const std::vector<std::pair<Relocation *, const Relocation *>> &
+  getRelativeRelocs() const {
+    return RelativeRelocs;
+  }
+
+  void clearScannedEntries() {
+    RequestedGOTs.clear();
+    RequestedPLTs.clear();
+    RelativeRelocs.clear();
+  }
+
   // --- SectionGroup Support
   void addSectionGroup(ELFSection *S) { GroupSections.push_back(S); }
 
@@ -91,6 +137,9 @@ private:
   ELFSection *RelaPLT = nullptr;
   ELFSection *GOTPatch = nullptr;
   ELFSection *RelaPatch = nullptr;
+  std::vector<std::pair<Relocation *, uint32_t>> RequestedGOTs;
+  std::vector<std::pair<ResolveInfo *, bool>> RequestedPLTs;
+  std::vector<std::pair<Relocation *, const Relocation *>> RelativeRelocs;
 };
 
 } // namespace eld
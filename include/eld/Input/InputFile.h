@@ -9,6 +9,8 @@
 
 #include "eld/Support/MappingFile.h"
 #include "llvm/ADT/StringRef.h"
+#include <atomic>
+#include <cstdint>
 #include <mutex>
 
 namespace eld {
@@ -124,6 +126,12 @@ public:
 
   virtual bool isThinArchive() const { return false; }
 
+  /// Counts the relocations of this file that plugin::Use::resetSymbol
+  /// retargeted to another symbol. Such edits do not go through the Module.
+  void recordRelocationEdit() { ++RelocationEdits; }
+
+  uint64_t getRelocationEdits() const { return RelocationEdits; }
+
 protected:
   Input *I = nullptr;
   llvm::StringRef Contents;
@@ -134,6 +142,7 @@ protected:
   bool Needed = false;
   bool Used = false;
   bool Skip = false;
+  std::atomic<uint64_t> RelocationEdits{0};
   std::mutex Mutex;
 };
 
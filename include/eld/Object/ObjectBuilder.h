@@ -14,10 +14,14 @@
 #ifndef ELD_OBJECT_OBJECTBUILDER_H
 #define ELD_OBJECT_OBJECTBUILDER_H
 #include "eld/Input/ObjectFile.h"
+#include "eld/Object/RuleMatchCache.h"
 #include "eld/PluginAPI/SectionIteratorPlugin.h"
 #include "eld/Target/LDFileFormat.h"
+#include "llvm/ADT/ArrayRef.h"
 #include "llvm/Support/DataTypes.h"
+#include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <unordered_set>
 
@@ -87,6 +91,18 @@ public:
 
   void mergeStrings(MergeStringFragment *F, OutputSectionEntry *O);
 
+  /// Merges the strings of Fragments, in order, into the output section O
+  /// using the thread pool. The strings are partitioned by the string shards
+  /// of O and each shard is merged by one thread in string order, so the
+  /// result is the same as calling mergeStrings for each fragment.
+  void mergeStringsInParallel(llvm::ArrayRef<MergeStringFragment *> Fragments,
+                              OutputSectionEntry *O);
+
+  /// Merges each unique string of the output section O that is a suffix of
+  /// another unique string of O into that string (--merge-strings=tail).
+  /// This must run after identical strings have been merged.
+  void tailMergeStrings(OutputSectionEntry *O);
+
 private:
   bool shouldSkipMergeSection(ELFSection *) const;
 
@@ -104,16 +120,26 @@ private:
   /// performed.
   std::vector<Section *> getInputSectionsForRuleMatching(ObjectFile *ObjFile);
 
-  /// (try to) Match section S using cache.
+  /// (try to) Match the sections of ObjFile using the rule-matching cache.
   ///
-  /// Returns true if section is matched using cache-file; Otherwise returns
-  /// false.
+  /// Returns true if all sections are matched using cache-file; Otherwise
+  /// returns false and sets Key if the rule-matching results of ObjFile
+  /// should be stored in the cache after matching.
+  bool matchUsingCache(ObjectFile *ObjFile, std::optional<uint64_t> &Key);
+
+  /// Stores the rule-matching results of ObjFile in the cache file for Key.
+  void storeInCache(ObjectFile *ObjFile, uint64_t Key);
 
 private:
+  /// Returns true if S is left out of rule matching because it is already
+  /// ignored or discarded.
+  static bool isSkippedForRuleMatching(const Section *S);
+
   LinkerConfig &ThisConfig;
   Module &ThisModule;
   std::mutex Mutex;
   bool HasLinkerScript;
+  std::unique_ptr<RuleMatchCache> MRuleMatchCache;
 };
 
 } // namespace eld
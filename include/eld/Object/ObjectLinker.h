@@ -47,6 +47,7 @@ class DynObjWriter;
 class ELFSection;
 class ELFExecutableFileReader;
 class ExecWriter;
+class GarbageCollection;
 class GNULDBackend;
 class GroupReader;
 class Input;
@@ -255,6 +256,10 @@ public:
   bool mergeInputSections(ObjectBuilder &Builder,
                           std::vector<Section *> &Sections);
 
+  /// Splits the .eh_frame sections and creates their CIE and FDE fragments
+  /// on all threads, ahead of mergeInputSections.
+  bool splitEhFrameSections(std::vector<Section *> &Sections);
+
   bool mayBeSortSections(std::vector<Section *> &Sections);
 
   bool createOutputSection(ObjectBuilder &Builder, OutputSectionEntry *Output,
@@ -284,6 +289,17 @@ public:
 
   bool readInputs(const std::vector<Node *> &N);
 
+  /// Decodes the relocatable object files in N concurrently ahead of
+  /// readInputs when reading inputs is multithreaded.
+  bool decodeInputs(const std::vector<Node *> &N);
+
+  /// Decodes the relocatable object members of an archive concurrently,
+  /// ahead of including them with readAndProcessInput.
+  void decodeArchiveMembers(const std::vector<Input *> &Members);
+
+  /// Drops the decoded tables of an input that is not going to be read.
+  void discardDecodedInput(const Input *I);
+
   bool getInputs(std::vector<InputFile *> &Inputs);
 
   // ---------------------SectionIterator Plugin Support ------------------
@@ -361,6 +377,11 @@ public:
     MMemoryAreaToArchiveFileMap[MemArea] = &AF;
   }
 
+  /// applyRelocationForUse - with --apply-relocations-in-place, apply R when
+  /// a plugin reads its target data after relocation() has run, so that the
+  /// plugin does not see unrelocated data.
+  void applyRelocationForUse(Relocation *R);
+
 private:
   std::unique_ptr<llvm::lto::LTO> ltoInit(llvm::lto::Config Conf);
 
@@ -370,6 +391,15 @@ private:
 
   bool doLto(llvm::lto::LTO &LTO);
 
+  /// shouldApplyRelocation - return false for relocations that must not be
+  /// applied, for example because they are relaxed or refer to discarded
+  /// sections.
+  bool shouldApplyRelocation(Relocation *R);
+
+  /// shouldSyncRelocation - return false for relocations whose result must
+  /// not be written to the output.
+  bool shouldSyncRelocation(const Relocation *R) const;
+
   /// writeRelocationResult - helper function of syncRelocationResult, write
   /// relocation target data to output
   void writeRelocationResult(Relocation &PReloc, uint8_t *POutput);
@@ -384,6 +414,13 @@ private:
 
   bool insertPostLTOELF();
 
+  /// Returns the ELF relocatable object file of Input, creating it if needed,
+  /// or nullptr if the input cannot be decoded ahead of time.
+  InputFile *getDecodableObjectFile(Input *Input);
+
+  /// Decodes Objects concurrently on the module thread pool.
+  void decodeObjectFiles(const std::vector<InputFile *> &Objects);
+
   size_t getRelocSectSize(uint32_t Type, uint32_t Count);
 
   std::pair<std::optional<llvm::Reloc::Model>, std::string>
@@ -479,6 +516,12 @@ private:
   // Set to true once any GC pass has run. Used to know if shouldIgnore() on
   // a symbol is meaningful.
   bool MGcHasRun = false;
+  // --apply-relocations-in-place: relocations are applied by syncRelocations.
+  bool ApplyRelocationsInPlace = false;
+
+  // Kept across the GC passes so that passes requested by plugins only walk
+  // what changed since the previous pass.
+  GarbageCollection *MGarbageCollection = nullptr;
 
   bool MSaveTemps;
 
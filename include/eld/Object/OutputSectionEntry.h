@@ -12,9 +12,13 @@
 #include "eld/Script/Assignment.h"
 #include "eld/Script/OutputSectDesc.h"
 #include "eld/Target/LDFileFormat.h"
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/CachedHashString.h"
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/StringMap.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/Support/DataTypes.h"
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <string>
@@ -144,14 +148,19 @@ public:
 
   void addBranchIsland(BranchIsland *B) { MBranchIslands.push_back(B); }
 
-  void addBranchIsland(ResolveInfo *PSym, BranchIsland *B) {
-    BranchIslandForSymbol[PSym];
-    BranchIslandForSymbol[PSym].push_back(B);
-    MBranchIslands.push_back(B);
-  }
+  /// Record B as a branch island for PSym. The islands of each symbol are
+  /// kept sorted by address, which fragment order preserves across layouts.
+  void addBranchIsland(Module &M, ResolveInfo *PSym, BranchIsland *B);
 
   uint32_t getNumBranchIslands() const { return MBranchIslands.size(); }
 
+  // ------------------Incremental layout support -------------------------
+  /// The layout of the section is stale: fragments were added, removed or
+  /// resized since offsets were last assigned to it.
+  void setLayoutDirty(bool Dirty = true) { MLayoutDirty = Dirty; }
+
+  bool isLayoutDirty() const { return MLayoutDirty; }
+
   void dump(llvm::raw_ostream &Outs) const;
 
   uint64_t getHash() {
@@ -163,14 +172,9 @@ public:
   std::string getSectionTypeStr() const;
 
   // ----------------------Reuse trampolines optimization---------------
-  std::vector<BranchIsland *>
-  getBranchIslandsForSymbol(ResolveInfo *PSym) const {
-    std::vector<BranchIsland *> Islands;
-    auto Iter = BranchIslandForSymbol.find(PSym);
-    if (Iter == BranchIslandForSymbol.end())
-      return Islands;
-    return Iter->second;
-  }
+  /// Return the branch islands for PSym, sorted by address.
+  const std::vector<BranchIsland *> &
+  getBranchIslandsForSymbol(ResolveInfo *PSym) const;
 
   // -------------------- Add Linker script rules ------------------------
   RuleContainer *createRule(eld::Module &M, std::string Annotation,
@@ -182,9 +186,20 @@ public:
 
   // -------------------- String merging support -------------------------
 
+  /// The unique strings are split into shards by string hash. Identical
+  /// strings always belong to the same shard, so distinct shards can be
+  /// merged by distinct threads.
+  static constexpr unsigned StringShardBits = 5;
+  static constexpr unsigned NumStringShards = 1 << StringShardBits;
+
+  static unsigned getStringShard(const MergeableString *S) {
+    return S->Hash >> (32 - StringShardBits);
+  }
+
   MergeableString *getMergedString(const MergeableString *S) const {
-    auto Str = UniqueStrings.find(S->String);
-    if (Str == UniqueStrings.end())
+    const UniqueStringMap &Shard = UniqueStrings[getStringShard(S)];
+    auto Str = Shard.find(llvm::CachedHashStringRef(S->String, S->Hash));
+    if (Str == Shard.end())
       return nullptr;
     MergeableString *MergedString = Str->second;
     if (MergedString == S)
@@ -194,7 +209,29 @@ public:
 
   void addString(MergeableString *S) {
     AllStrings.push_back(S);
-    UniqueStrings.insert({S->String, S});
+    addUniqueString(S);
+  }
+
+  /// Adds S to the unique strings if no identical string has been added, and
+  /// returns the string that was added first. Strings of distinct shards may
+  /// be added concurrently.
+  MergeableString *addUniqueString(MergeableString *S) {
+    UniqueStringMap &Shard = UniqueStrings[getStringShard(S)];
+    return Shard.try_emplace(llvm::CachedHashStringRef(S->String, S->Hash), S)
+        .first->second;
+  }
+
+  /// Merges the unique string S, which is a suffix of Into, into Into.
+  /// Strings identical to S are then merged into Into as well.
+  void mergeTailString(MergeableString *S, MergeableString *Into) {
+    S->exclude();
+    UniqueStrings[getStringShard(S)][llvm::CachedHashStringRef(
+        S->String, S->Hash)] = Into;
+  }
+
+  /// Records the strings, in order, without merging them.
+  void appendStrings(llvm::ArrayRef<MergeableString *> Strings) {
+    AllStrings.append(Strings.begin(), Strings.end());
   }
 
   uint64_t getTrampolineCount(const std::string &TrampolineName);
@@ -224,10 +261,13 @@ private:
   std::vector<BranchIsland *> MBranchIslands;
   std::unordered_map<ResolveInfo *, std::vector<BranchIsland *>>
       BranchIslandForSymbol;
-  llvm::StringMap<MergeableString *> UniqueStrings;
+  typedef llvm::DenseMap<llvm::CachedHashStringRef, MergeableString *>
+      UniqueStringMap;
+  std::array<UniqueStringMap, NumStringShards> UniqueStrings;
   llvm::SmallVector<MergeableString *, 0> AllStrings;
   uint64_t MHash = 0;
   llvm::StringMap<uint64_t> MTrampolineNameToCountMap;
+  bool MLayoutDirty = true;
 };
 
 } // namespace eld
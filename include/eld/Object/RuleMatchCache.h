@@ -0,0 +1,99 @@
+//===- RuleMatchCache.h----------------------------------------------------===//
+// Part of the eld Project, under the BSD License
+// See https://github.com/qualcomm/eld/LICENSE.txt for license information.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+#ifndef ELD_OBJECT_RULEMATCHCACHE_H
+#define ELD_OBJECT_RULEMATCHCACHE_H
+
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/StringRef.h"
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace eld {
+
+class InputFile;
+class LinkerConfig;
+class Module;
+
+/** \class RuleMatchCache
+ *  \brief On-disk cache of linker script rule matching results.
+ *
+ * The cache stores, for each input file, the index of the rule matched by
+ * each of its input sections. A cache file is keyed by a hash of the linker
+ * script rules, the options that affect rule matching, and the contents, path
+ * and member name of the input file. Therefore, a cache file is only found
+ * if the same input is linked again with the same rules. All hashes are
+ * computed with xxh3 so that the keys are stable across linker runs.
+ */
+class RuleMatchCache {
+public:
+  /// Rule index of an input section that does not match any rule.
+  static constexpr uint32_t NoRule = UINT32_MAX;
+
+  enum EntryFlags : uint32_t {
+    None = 0x0,
+    /// The input section is discarded by the matched rule.
+    Discarded = 0x1,
+    /// The input section was not matched because it was already ignored or
+    /// discarded when rules were matched, for example a group member that
+    /// was preempted by another group. The entry is only valid while this is
+    /// still the case, since group resolution depends on the other inputs.
+    Skipped = 0x2
+  };
+
+  struct Entry {
+    uint64_t NameHash;
+    uint32_t RuleIdx;
+    uint32_t Flags;
+  };
+
+  /// Computes the rules hash from the rule matcher of the module, which
+  /// must already be built.
+  RuleMatchCache(Module &M, llvm::StringRef Dir);
+
+  /// Creates the cache directory. Returns false, after raising a warning, if
+  /// the directory cannot be used.
+  bool init(const LinkerConfig &Config);
+
+  /// Returns the hash that identifies the rules and the rule matching
+  /// options.
+  uint64_t getRulesHash() const { return RulesHash; }
+
+  /// Returns the cache key of the input file.
+  uint64_t getKey(const InputFile &I) const;
+
+  /// Returns the cache file path for the key.
+  std::string getPath(uint64_t Key) const;
+
+  /// Reads the cached entries for the key, if the cache file exists and is
+  /// well-formed.
+  std::optional<std::vector<Entry>> read(uint64_t Key) const;
+
+  /// Writes the entries for the key. The file is written to a temporary file
+  /// first and renamed, so that concurrent links sharing the cache directory
+  /// never observe a partially written file.
+  bool write(uint64_t Key, llvm::ArrayRef<Entry> Entries) const;
+
+  static uint64_t getNameHash(llvm::StringRef Name);
+
+  // ----------------------- Stats ---------------------------------
+  void addHit() { ++NumHits; }
+  void addMiss() { ++NumMisses; }
+  uint64_t getNumHits() const { return NumHits; }
+  uint64_t getNumMisses() const { return NumMisses; }
+
+private:
+  std::string Dir;
+  uint64_t RulesHash = 0;
+  std::atomic<uint64_t> NumHits{0};
+  std::atomic<uint64_t> NumMisses{0};
+};
+
+} // namespace eld
+
+#endif
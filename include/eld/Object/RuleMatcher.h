@@ -0,0 +1,102 @@
+//===- RuleMatcher.h-------------------------------------------------------===//
+// Part of the eld Project, under the BSD License
+// See https://github.com/qualcomm/eld/LICENSE.txt for license information.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+#ifndef ELD_OBJECT_RULEMATCHER_H
+#define ELD_OBJECT_RULEMATCHER_H
+
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringRef.h"
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace eld {
+
+class OutputSectionEntry;
+class RuleContainer;
+class SectionMap;
+
+/** \class RuleMatcher
+ *  \brief Index of the input section patterns of all linker script rules.
+ *
+ * Section patterns without wildcards are kept in a hash table keyed by the
+ * pattern hash, patterns of the form 'prefix*' and '*suffix' are kept in a
+ * prefix and a suffix trie, and all other patterns are kept in a fallback
+ * list. For an input section name, the index returns only the rules that have
+ * a section pattern which can match the name, in linker script order.
+ *
+ * The index does not look at file, archive and EXCLUDE_FILE patterns; each
+ * candidate rule must still be checked with SectionMap::matched.
+ */
+class RuleMatcher {
+public:
+  typedef std::pair<OutputSectionEntry *, RuleContainer *> Rule;
+  typedef llvm::SmallVector<uint32_t, 16> CandidateList;
+
+  /// Builds the index from the rules of all output sections in 'SM'. Any
+  /// previously built index is discarded.
+  void build(SectionMap &SM);
+
+  /// Fills 'Candidates' with the indices of the rules that may match the
+  /// section 'Name' with hash 'NameHash', sorted in linker script order.
+  void getCandidates(llvm::StringRef Name, uint64_t NameHash,
+                     CandidateList &Candidates) const;
+
+  const Rule &getRule(uint32_t Idx) const { return Rules[Idx]; }
+
+  /// Returns the index of the rule 'R', if it is indexed.
+  std::optional<uint32_t> getRuleIndex(const RuleContainer *R) const {
+    auto It = RuleIndices.find(R);
+    if (It == RuleIndices.end())
+      return std::nullopt;
+    return It->second;
+  }
+
+  size_t size() const { return Rules.size(); }
+
+  // ----------------------- Stats ---------------------------------
+  uint32_t getNumExactPatterns() const { return NumExactPatterns; }
+  uint32_t getNumPrefixPatterns() const { return NumPrefixPatterns; }
+  uint32_t getNumSuffixPatterns() const { return NumSuffixPatterns; }
+  uint32_t getNumGlobPatterns() const { return NumGlobPatterns; }
+
+  void addNumRuleChecks(uint64_t N) { NumRuleChecks += N; }
+  uint64_t getNumRuleChecks() const { return NumRuleChecks; }
+
+private:
+  struct TrieNode {
+    llvm::SmallVector<std::pair<char, uint32_t>, 2> Children;
+    llvm::SmallVector<uint32_t, 1> Rules;
+  };
+
+  static uint32_t findChild(const TrieNode &Node, char C);
+
+  static void insert(std::vector<TrieNode> &Trie, llvm::StringRef Key,
+                     bool Reverse, uint32_t RuleIdx);
+
+  static void lookup(const std::vector<TrieNode> &Trie, llvm::StringRef Name,
+                     bool Reverse, CandidateList &Candidates);
+
+private:
+  std::vector<Rule> Rules;
+  llvm::DenseMap<const RuleContainer *, uint32_t> RuleIndices;
+  std::unordered_map<uint64_t, llvm::SmallVector<uint32_t, 1>> ExactRules;
+  std::vector<TrieNode> PrefixTrie;
+  std::vector<TrieNode> SuffixTrie;
+  std::vector<uint32_t> GlobRules;
+  uint32_t NumExactPatterns = 0;
+  uint32_t NumPrefixPatterns = 0;
+  uint32_t NumSuffixPatterns = 0;
+  uint32_t NumGlobPatterns = 0;
+  std::atomic<uint64_t> NumRuleChecks{0};
+};
+
+} // namespace eld
+
+#endif
@@ -14,6 +14,7 @@
 #define ELD_OBJECT_SECTIONMAP_H
 #include "eld/Object/OutputSectionEntry.h"
 #include "eld/Object/RuleContainer.h"
+#include "eld/Object/RuleMatcher.h"
 #include "eld/Script/InputSectDesc.h"
 #include "eld/Script/OutputSectDesc.h"
 #include "eld/Script/WildcardPattern.h"
@@ -150,6 +151,12 @@ public:
   bool doesRuleMatchWithSection(const RuleContainer &R, const Section &S,
                                 bool DoNotUseRmName) const;
 
+  /// Builds the index used to find the rules that may match an input section
+  /// by name. It must be rebuilt whenever rules are added or removed.
+  void buildRuleMatcher() { MRuleMatcher.build(*this); }
+
+  RuleMatcher &getRuleMatcher() { return MRuleMatcher; }
+
 private:
   bool matchedSections(InputFile *I, const WildcardPattern &InputFilePattern,
                        const WildcardPattern &PPattern,
@@ -183,6 +190,7 @@ private:
   std::vector<ELFSection *> MEntrySections;
   const DiagnosticPrinter *MPrinter;
   LayoutInfo *MLayoutInfo = nullptr;
+  RuleMatcher MRuleMatcher;
 };
 
 } // namespace eld
@@ -41,6 +41,14 @@ public:
   // clang-format on
   eld::Expected<uint32_t> parseFile(InputFile &inputFile) const;
 
+  /// Includes the archive members that define the pending lazy symbols of the
+  /// archive, until no more symbols of the archive are pending. Returns the
+  /// number of members included.
+  ///
+  /// Symbols only become pending when a symbol with the same name is inserted
+  /// in the NamePool, so this does not scan the archive symbol table.
+  uint32_t resolveLazySymbols(ArchiveFile &archiveFile) const;
+
   struct ArchiveSymbol {
     uint64_t ChildOffset = 0;
     llvm::StringRef SymbolName;
@@ -129,6 +137,14 @@ private:
                     const llvm::object::Archive::Child &member,
                     ArchiveFile *archive) const;
 
+  /// Returns the members that define the pending symbols that would be
+  /// included with the current state of the NamePool, in symbol table order.
+  /// These members are decoded concurrently before they are included.
+  std::vector<Input *> getSelectedMembers(ArchiveFile &archiveFile) const;
+
+  /// Adds the archive symbols to the NamePool as lazy symbols.
+  void addLazySymbols(ArchiveFile &archiveFile) const;
+
   /// Includes all the archive members of the archive in the link process.
   eld::Expected<uint32_t> includeAllMembers(ArchiveFile *archive) const;
 
@@ -13,11 +13,13 @@
 #include "eld/Readers/ELFReaderBase.h"
 #include "eld/Readers/Relocation.h"
 #include "eld/Target/LDFileFormat.h"
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/Object/ELF.h"
 #include "llvm/Object/ELFTypes.h"
 #include <optional>
 #include <type_traits>
+#include <vector>
 
 /// If val contains a LLVM error, then return diagnostic entry created from the
 /// corresponding llvm::Error. Otherwise, assign the correponding value from val
@@ -75,6 +77,10 @@ public:
   /// the input file.
   eld::Expected<bool> readSymbols() override;
 
+  /// Decodes the section header table, section names and kinds, symbol names
+  /// and relocation tables ahead of IR creation.
+  eld::Expected<bool> decodeTables() override;
+
   /// Checks that the flags present in e_flags member of ELF header are valid
   /// as per the targets.
   eld::Expected<bool> checkFlags() const override;
@@ -108,9 +114,11 @@ protected:
   /// Computes and returns the section name.
   eld::Expected<std::string> getSectionName(Elf_Shdr rawSectHdr);
 
-  /// Computes and return the section kind.
+  /// Computes and return the section kind. Unsupported sections are only
+  /// diagnosed if diagnose is true.
   LDFileFormat::Kind getSectionKind(Elf_Shdr rawSectHdr,
-                                    llvm::StringRef sectionName);
+                                    llvm::StringRef sectionName,
+                                    bool diagnose = true);
 
   /// Create and return eld::ELFSection from the raw section header.
   virtual eld::Expected<ELFSection *> createSection(Elf_Shdr rawSectHdr) = 0;
@@ -194,6 +202,26 @@ protected:
   const std::optional<llvm::object::ELFFile<ELFT>> m_LLVMELFFile;
   std::optional<llvm::ArrayRef<Elf_Shdr>> m_RawSectHdrs;
 
+  // Tables decoded by decodeTables(). Section and symbol names are dropped
+  // once the corresponding IR is created; relocation tables are kept until
+  // the relocations are read.
+  std::vector<llvm::StringRef> m_DecodedSectNames;
+  std::vector<LDFileFormat::Kind> m_DecodedSectKinds;
+  std::vector<llvm::StringRef> m_DecodedSymNames;
+  llvm::DenseMap<uint32_t, Elf_Rel_Range> m_DecodedRels;
+  llvm::DenseMap<uint32_t, Elf_Rela_Range> m_DecodedRelas;
+  // Sizes and hashes of the strings of merge string sections, by section
+  // index.
+  struct DecodedMergeStrings {
+    std::vector<uint32_t> Sizes;
+    std::vector<uint32_t> Hashes;
+  };
+  llvm::DenseMap<uint32_t, DecodedMergeStrings> m_DecodedMergeStrings;
+
+  /// Records the sizes and hashes of the strings in the merge string section
+  /// sectIdx.
+  void decodeMergeStrings(uint32_t sectIdx, const Elf_Shdr &rawSectHdr);
+
   /// Returns the explicit addend associated with the relocation.
   typename ELFReader<ELFT>::intX_t
   getAddend(const typename ELFReader<ELFT>::Elf_Rela &R) {
@@ -210,6 +238,19 @@ protected:
   template <bool isRela>
   eld::Expected<RelRangeType<isRela>>
   getRelocations(const typename ELFReader<ELFT>::Elf_Shdr &rawSect) {
+    if (m_RawSectHdrs && &rawSect >= m_RawSectHdrs->begin() &&
+        &rawSect < m_RawSectHdrs->end()) {
+      uint32_t idx = &rawSect - m_RawSectHdrs->begin();
+      if constexpr (isRela) {
+        auto I = m_DecodedRelas.find(idx);
+        if (I != m_DecodedRelas.end())
+          return I->second;
+      } else {
+        auto I = m_DecodedRels.find(idx);
+        if (I != m_DecodedRels.end())
+          return I->second;
+      }
+    }
     if constexpr (isRela) {
       llvm::Expected<RelRangeType<isRela>> expRelRange =
           this->m_LLVMELFFile->relas(rawSect);
@@ -46,6 +46,15 @@ public:
   /// the input file.
   virtual eld::Expected<bool> readSymbols() = 0;
 
+  /// Decodes the section header table, section names and kinds, symbol names
+  /// and relocation tables without creating any linker IR. The decoded tables
+  /// are cached in the reader and reused by readSectionHeaders, readSymbols
+  /// and readRelocationSection.
+  ///
+  /// This function only reads the input file contents, and therefore it is
+  /// safe to call it concurrently for readers of distinct input files.
+  virtual eld::Expected<bool> decodeTables() { return true; }
+
   /// Checks that the flags present in e_flags member of ELF header are valid
   /// as per the targets.
   virtual eld::Expected<bool> checkFlags() const = 0;
@@ -9,6 +9,8 @@
 #include "eld/PluginAPI/Expected.h"
 #include "eld/Readers/ELFReaderBase.h"
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 
 namespace eld {
 class Module;
@@ -49,7 +51,31 @@ public:
 
   eld::Expected<bool> readRelocations(InputFile &inputFile);
 
+  /// Creates the reader for inputFile and decodes the ELF header, the section
+  /// header table, the symbol table and the relocation tables ahead of
+  /// parseFile. The reader is cached and is picked up by parseFile and
+  /// readRelocations. No linker IR is created and no symbol is inserted in the
+  /// NamePool, so this function may be called concurrently for distinct
+  /// input files.
+  ///
+  /// Errors are not reported here. If decoding fails, the reader is dropped
+  /// and parseFile reports the error in command-line order.
+  void decodeFile(InputFile &inputFile);
+
+  /// Drops the tables decoded by decodeFile for an input that is not going to
+  /// be parsed.
+  void discardDecodedFile(const InputFile &inputFile) {
+    takeDecodedReader(inputFile);
+  }
+
 private:
+  /// Removes and returns the reader cached for inputFile by decodeFile, if
+  /// any.
+  std::unique_ptr<ELFReaderBase> takeDecodedReader(const InputFile &inputFile);
+
+  /// Caches a decoded reader so that its relocation tables can be reused.
+  void keepDecodedReader(std::unique_ptr<ELFReaderBase> reader);
+
   eld::Expected<bool> readSectionHeaders(ELFReaderBase &ELFReader);
 
   eld::Expected<bool> readSections(ELFReaderBase &ELFReader);
@@ -74,6 +100,10 @@ private:
   eld::Expected<bool> readGroups(ELFReaderBase &ELFReader);
 
   Module &m_Module;
+
+  std::mutex m_DecodedReadersMutex;
+  std::unordered_map<const InputFile *, std::unique_ptr<ELFReaderBase>>
+      m_DecodedReaders;
 };
 
 } // namespace eld
@@ -263,6 +263,10 @@ public:
 
   llvm::SmallVectorImpl<Relocation *> &getRelocations() { return Relocations; }
 
+  void reserveRelocations(size_t N) {
+    Relocations.reserve(Relocations.size() + N);
+  }
+
   void addRelocation(Relocation *R) {
     assert(R);
     Relocations.push_back(R);
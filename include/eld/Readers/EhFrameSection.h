@@ -32,16 +32,33 @@ public:
     return S->getSectionKind() == Section::Kind::EhFrame;
   }
 
+  /// Splits the section into CIE and FDE pieces. Each piece is given the
+  /// relocation with the lowest offset in the piece, if any.
   bool splitEhFrameSection();
 
-  Relocation *getReloc(size_t Off, size_t Size);
+  bool isSplit() const { return m_IsSplit; }
+
+  /// Returns the piece that contains Offset, or the last piece if Offset is
+  /// past the end of the section. Pieces are sorted by offset, so the piece is
+  /// found with a binary search.
+  EhFramePiece *findPiece(size_t Offset);
 
   RegionFragment *getEhFrameFragment() const { return m_EhFrame; }
 
   llvm::ArrayRef<uint8_t> getData() const { return Data; }
 
+  /// Creates the CIE and FDE fragments from the pieces of a split section.
+  /// Splitting and creating the fragments only modify this section and read
+  /// the symbols that its relocations refer to, so they can run concurrently
+  /// for distinct sections.
   bool createCIEAndFDEFragments();
 
+  /// splitEhFrameSection and createCIEAndFDEFragments record the malformed
+  /// record that made them fail instead of raising it, so that sections split
+  /// on the thread pool are reported in section order.
+  bool hasReadError() const { return m_ReadError != nullptr; }
+  void raiseReadError() const;
+
   CIEFragment *addCie(EhFramePiece &P);
 
   bool isFdeLive(EhFramePiece &P);
@@ -64,6 +81,8 @@ private:
   std::vector<CIEFragment *> m_CIEFragments;
   size_t NumCie = 0;
   size_t NumFDE = 0;
+  bool m_IsSplit = false;
+  const char *m_ReadError = nullptr;
   DiagnosticEngine *m_DiagEngine = nullptr;
 };
 } // namespace eld
@@ -43,6 +43,12 @@ public:
   eld::Expected<ELFSection *>
   createSection(typename ELFReader<ELFT>::Elf_Shdr rawSectHdr) override;
 
+  /// Create an eld::ELFSection object for the raw section rawSectHdr using
+  /// an already computed section name and kind.
+  ELFSection *createSection(typename ELFReader<ELFT>::Elf_Shdr rawSectHdr,
+                            const std::string &sectName,
+                            LDFileFormat::Kind kind);
+
   /// Creates refined section headers by reading raw section headers.
   ///
   /// This function also adds references to all the created refined section
@@ -87,6 +93,13 @@ protected:
   template <bool isRela>
   eld::Expected<bool> readRelocationSection(ELFSection *RS);
 
+  /// Reads all relocations of RS in one batch. Used when the backend does not
+  /// handle relocations of the target section itself.
+  template <bool isRela>
+  eld::Expected<bool> readRelocations(
+      ELFSection *RS,
+      const typename ELFReader<ELFT>::template RelRangeType<isRela> &relRange);
+
   LDSymbol *fixWrapSyms(LDSymbol *sym);
 
   LDSymbol *createUndefReference(llvm::StringRef symName);
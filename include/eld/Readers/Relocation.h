@@ -40,11 +40,11 @@ public:
 
   Relocation();
 
-  Relocation(Type pType, FragmentRef *pTargetRef, Address pAddend,
+  Relocation(Type pType, const FragmentRef *pTargetRef, Address pAddend,
              DWord pTargetData);
 
-  Relocation(const Relocator *Relocator, Type pType, FragmentRef *pTargetRef,
-             Address pAddend);
+  Relocation(const Relocator *Relocator, Type pType,
+             const FragmentRef *pTargetRef, Address pAddend);
 
   ~Relocation();
 
@@ -52,8 +52,15 @@ public:
   /// Create - produce an empty relocation entry
   static Relocation *Create();
 
-  static Relocation *Create(Type pType, Size pSize, FragmentRef *pFragRef,
-                            Address pAddend = 0);
+  static Relocation *Create(Type pType, Size pSize,
+                            const FragmentRef *pFragRef, Address pAddend = 0);
+
+  /// Same as above. The place is copied into the relocation, so it can be a
+  /// temporary.
+  static Relocation *Create(Type pType, Size pSize, const FragmentRef &pFragRef,
+                            Address pAddend = 0) {
+    return Create(pType, pSize, &pFragRef, pAddend);
+  }
 
   /// Destroy - destroy a relocation entry
   static void Destroy(Relocation *&pRelocation);
@@ -90,10 +97,22 @@ public:
 
   DWord &target() { return m_TargetData; }
 
-  /// targetRef - the reference of the target data
-  FragmentRef *targetRef() const { return m_TargetAddress; }
+  /// targetRef - the reference of the target data. Returns FragmentRef::null()
+  /// if the place being relocated is not set.
+  const FragmentRef *targetRef() const {
+    return m_TargetRef.frag() ? &m_TargetRef : FragmentRef::null();
+  }
+
+  FragmentRef *targetRef() {
+    return m_TargetRef.frag() ? &m_TargetRef : FragmentRef::null();
+  }
+
+  /// setTargetRef - copy the place being relocated from ref.
+  void setTargetRef(const FragmentRef *ref) {
+    m_TargetRef = ref ? *ref : FragmentRef();
+  }
 
-  void setTargetRef(FragmentRef *ref) { m_TargetAddress = ref; }
+  void setTargetRef(const FragmentRef &ref) { m_TargetRef = ref; }
 
   size_t getOffset() const;
 
@@ -151,8 +170,9 @@ private:
   /// m_pSymInfo - resolved symbol info of relocation target symbol
   ResolveInfo *m_pSymInfo;
 
-  /// m_TargetAddress - FragmentRef of the place being relocated
-  FragmentRef *m_TargetAddress;
+  /// m_TargetRef - the place being relocated. It is stored inline rather than
+  /// as a separately allocated FragmentRef, and handed out by targetRef().
+  FragmentRef m_TargetRef;
 
   /// m_Addend - the addend
   Address m_Addend;
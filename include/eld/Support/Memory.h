@@ -22,42 +22,91 @@
 // Arena allocators are efficient and easy to understand.
 // Most objects are allocated using the arena allocators defined by this file.
 //
+// The arenas used by make<T> and Saver are per-thread, so both of them may
+// be used from worker threads without any locking. Objects allocated by a
+// worker thread stay alive after the thread exits, until freeArena().
+//
 //===----------------------------------------------------------------------===//
 
 #ifndef ELD_SUPPORT_MEMORY_H
 #define ELD_SUPPORT_MEMORY_H
 
+#include "llvm/ADT/StringRef.h"
+#include "llvm/ADT/Twine.h"
 #include "llvm/Support/Allocator.h"
 #include "llvm/Support/PrettyStackTrace.h"
-#include "llvm/Support/StringSaver.h"
+#include "llvm/Support/TypeName.h"
+#include "llvm/Support/raw_ostream.h"
+#include <string>
 #include <vector>
 
 namespace eld {
 
-// Use this arena if your object doesn't have a destructor.
-extern llvm::BumpPtrAllocator BAlloc;
-extern llvm::StringSaver Saver;
-void freeArena();
-
-// These two classes are hack to keep track of all
-// SpecificBumpPtrAllocator instances.
+// These classes are hack to keep track of all per-thread arenas.
 struct SpecificAllocBase {
-  SpecificAllocBase() { Instances.push_back(this); }
+  explicit SpecificAllocBase(llvm::StringRef TypeName) : TypeName(TypeName) {
+    registerInstance(this);
+  }
   virtual ~SpecificAllocBase() = default;
   virtual void reset() = 0;
+
+  // Bookkeeping for --print-timing-stats. Only the owning thread updates
+  // these.
+  llvm::StringRef TypeName;
+  uint64_t BytesAllocated = 0;
+  uint64_t NumAllocations = 0;
+
+  static void registerInstance(SpecificAllocBase *Alloc);
   static std::vector<SpecificAllocBase *> Instances;
 };
 
 template <class T> struct SpecificAlloc : public SpecificAllocBase {
+  SpecificAlloc() : SpecificAllocBase(llvm::getTypeName<T>()) {}
   void reset() override { Alloc.DestroyAll(); }
   llvm::SpecificBumpPtrAllocator<T> Alloc;
 };
 
+// Per-thread arena for objects that don't have a destructor, such as strings
+// and raw buffers.
+struct BumpAlloc : public SpecificAllocBase {
+  BumpAlloc() : SpecificAllocBase("<bytes>") {}
+  void reset() override { Alloc.Reset(); }
+  llvm::BumpPtrAllocator Alloc;
+};
+
+/// Returns the arena of the calling thread for objects without destructors.
+BumpAlloc &getThreadBumpAlloc();
+
+/// A StringSaver that copies strings into the arena of the calling thread.
+/// Unlike llvm::StringSaver, it may be used concurrently from many threads.
+class ConcurrentStringSaver {
+public:
+  llvm::StringRef save(const char *S) { return save(llvm::StringRef(S)); }
+  llvm::StringRef save(llvm::StringRef S);
+  llvm::StringRef save(const llvm::Twine &S);
+  llvm::StringRef save(const std::string &S) {
+    return save(llvm::StringRef(S));
+  }
+};
+
+// Use this arena if your object doesn't have a destructor. BAlloc must only be
+// used from the main thread; use getThreadBumpAlloc() from worker threads.
+extern llvm::BumpPtrAllocator BAlloc;
+extern ConcurrentStringSaver Saver;
+void freeArena();
+
+/// Prints the number of bytes allocated in the arenas, grouped by type.
+void printArenaStats(llvm::raw_ostream &OS);
+
 // Use this arena if your object has a destructor.
 // Your destructor will be invoked from freeArena().
 template <typename T, typename... U> T *make(U &&...Args) {
-  static SpecificAlloc<T> Alloc;
-  return new (Alloc.Alloc.Allocate()) T(std::forward<U>(Args)...);
+  // Every thread gets its own slab. The slab is owned by
+  // SpecificAllocBase::Instances and outlives the thread.
+  static thread_local SpecificAlloc<T> *Alloc = new SpecificAlloc<T>();
+  Alloc->BytesAllocated += sizeof(T);
+  ++Alloc->NumAllocations;
+  return new (Alloc->Alloc.Allocate()) T(std::forward<U>(Args)...);
 }
 
 const char *getUninitBuffer(uint32_t Sz);
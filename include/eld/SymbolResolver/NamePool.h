@@ -21,6 +21,7 @@
 #include "eld/SymbolResolver/Resolver.h"
 #include "eld/SymbolResolver/SymbolInfo.h"
 #include "eld/SymbolResolver/SymbolResolutionInfo.h"
+#include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/StringMap.h"
 #include "llvm/ADT/StringRef.h"
 #include <map>
@@ -29,6 +30,7 @@
 
 namespace eld {
 
+class ArchiveFile;
 class LayoutInfo;
 class LDSymbol;
 class Module;
@@ -134,6 +136,21 @@ public:
   addUndefinedELFSymbol(InputFile *I, std::string SymbolName,
                         ResolveInfo::Visibility Vis = ResolveInfo::Default);
 
+  // -------------------------- Lazy Symbols ------------------------------
+  /// Adds the archive symbol at index Idx of the archive symbol table as a
+  /// lazy symbol. Whenever a symbol with the same name is inserted in the
+  /// NamePool, the archive symbol is marked as pending in the archive, so
+  /// that archive resolution only needs to look at symbols that may now pull
+  /// in a member.
+  void addLazySymbol(llvm::StringRef SymbolName, ArchiveFile *Archive,
+                     uint32_t Idx);
+
+  size_t getNumLazySymbols() const { return LazySymbols.size(); }
+
+private:
+  /// Marks the lazy archive symbols named SymbolName as pending.
+  void notifyLazySymbols(llvm::StringRef SymbolName);
+
 private:
   eld::LinkerConfig &ThisConfig;
   Resolver *SymbolResolver;
@@ -143,6 +160,8 @@ private:
   SymbolResolutionInfo SymbolResInfo;
   std::map<const ResolveInfo *, LDSymbol *> SharedLibsSymbols;
   PluginManager &PM;
+  llvm::StringMap<llvm::SmallVector<std::pair<ArchiveFile *, uint32_t>, 1>>
+      LazySymbols;
 };
 
 } // namespace eld
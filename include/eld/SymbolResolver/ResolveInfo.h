@@ -18,6 +18,7 @@
 #include "eld/Input/Input.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/Support/DataTypes.h"
+#include <atomic>
 #include <string>
 
 namespace eld {
@@ -99,6 +100,11 @@ public:
 
   void setReserved(uint32_t Reserved);
 
+  /// reserve - atomically set the reserved bits in Reserved. Returns true if
+  /// this call set any of them, so that only one of the threads scanning
+  /// relocations creates the reserved entries.
+  bool reserve(uint32_t Reserved);
+
   void setSize(SizeType Size) { SymbolSize = Size; }
 
   void setValue(uint64_t Value, bool IsFinal) {
@@ -276,8 +282,8 @@ private:
   static const uint32_t SymbolOffset = 11;
   static const uint32_t SymbolMask = 1 << SymbolOffset;
 
-  static const uint32_t ReservedOffset = 12;
-  static const uint32_t ReservedMask = 0xF << ReservedOffset;
+  // Bits 12-15 were used for the reserved entries, which are now kept in
+  // ReservedBits so that they can be set atomically.
 
   static const uint32_t ExportDynOffset = 16;
   static const uint32_t ExportDynMask = 1 << ExportDynOffset;
@@ -319,6 +325,8 @@ public:
   static const uint32_t PatchableFlag = 1 << PatchableOffset;
   ResolveInfo();
   ResolveInfo(llvm::StringRef SymbolName);
+  ResolveInfo(const ResolveInfo &Other);
+  ResolveInfo &operator=(const ResolveInfo &Other);
   ~ResolveInfo();
 
 private:
@@ -326,6 +334,7 @@ private:
   uint64_t SymbolValue;
   LDSymbol *OutputSymbol;
   uint32_t ThisBitField;
+  std::atomic<uint8_t> ReservedBits;
   llvm::StringRef SymbolName;
   ResolveInfo *SymbolAlias;
   InputFile *SymbolResolvedOrigin;
@@ -30,6 +30,7 @@
 #include "llvm/ADT/StringMap.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/BinaryFormat/ELF.h"
+#include <atomic>
 #include <tuple>
 #include <unordered_map>
 #include <utility>
@@ -479,6 +480,12 @@ public:
 
   void evaluateAssignments(OutputSectionEntry *output, uint32_t &atIndex);
 
+  /// reuseOutputSectionLayout - Skip evaluating an output section whose
+  /// fragments did not change since it was last laid out, and whose offsets do
+  /// not depend on its address. Only the input section addresses are moved if
+  /// the output section moved.
+  bool reuseOutputSectionLayout(OutputSectionEntry *output);
+
   void evaluateAssignmentsAtEndOfOutputSection(OutputSectionEntry *output);
 
   // Print padding between end and start fragments of adjacent rules
@@ -659,6 +666,12 @@ public:
     m_RelativeRelocMap[R] = N;
   }
 
+  /// mergeScannedEntries - create the GOT and PLT entries that were requested
+  /// on Obj while its relocations were scanned, unless an earlier file already
+  /// created them, and merge the relative relocations recorded on Obj. Called
+  /// for each file in input order.
+  virtual void mergeScannedEntries(ELFObjectFile &Obj);
+
   // Patching sections.
   ELFSection *getGOTPatch() const;
   ELFSection *getRelaPatch() const;
@@ -694,6 +707,13 @@ public:
 
   virtual bool handlePendingRelocations(ELFSection *S) { return true; }
 
+  /// Returns true if handleRelocation may handle relocations that apply to
+  /// pSection. Readers do not call handleRelocation for the relocations of
+  /// sections for which this returns false.
+  virtual bool mayHandleRelocations(const ELFSection *pSection) const {
+    return false;
+  }
+
   virtual bool shouldIgnoreRelocSync(Relocation *Reloc) const { return false; }
 
   // ------------------- EhFrame Hdr -------------------------------
@@ -1047,8 +1067,9 @@ protected:
   ELFSection *m_pEhFrameFillerSection = nullptr;
 
   // ----- dynamic flags ----- //
-  // DF_TEXTREL of DT_FLAGS
-  bool m_bHasTextRel = false;
+  // DF_TEXTREL of DT_FLAGS, set while relocations are scanned on several
+  // threads.
+  std::atomic<bool> m_bHasTextRel{false};
 
   // DF_STATIC_TLS of DT_FLAGS
   bool m_bHasStaticTLS = false;
@@ -1115,6 +1136,17 @@ protected:
   std::vector<Relocation *> m_InternalRelocs;
   std::unordered_map<OutputSectionEntry *, std::vector<Fragment *>>
       OutputSectionToFrags;
+  // Incremental layout support, used between iterations of relax().
+  struct OutputSectionLayout {
+    uint64_t Addr = 0;
+    uint64_t PAddr = 0;
+    bool CanReuse = false;
+  };
+  llvm::DenseMap<OutputSectionEntry *, OutputSectionLayout>
+      m_OutputSectionLayouts;
+  bool m_IncrementalLayout = false;
+  uint32_t m_NumSectionsLaidOut = 0;
+  uint32_t m_NumSectionsRecomputed = 0;
   llvm::StringMap<ResolveInfo *> m_ProvideStandardSymbols;
   // Unique output section support
   std::unordered_map<ELFSection *, ELFSection *>
@@ -53,10 +53,13 @@ public:
     Version,
   };
 
+  /// Returns Error for unsupported section types, and raises
+  /// err_unsupported_section unless Diagnose is false.
   static Kind getELFSectionKind(uint32_t Flags, uint32_t AddrAlign,
                                 uint32_t EntSize, uint32_t Type,
                                 llvm::StringRef Name,
-                                const LinkerConfig &Config);
+                                const LinkerConfig &Config,
+                                bool Diagnose = true);
 
 protected:
   LDFileFormat() {}
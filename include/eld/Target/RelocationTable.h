@@ -0,0 +1,34 @@
+//===- RelocationTable.h---------------------------------------------------===//
+// Part of the eld Project, under the BSD License
+// See https://github.com/qualcomm/eld/LICENSE.txt for license information.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+#ifndef ELD_TARGET_RELOCATIONTABLE_H
+#define ELD_TARGET_RELOCATIONTABLE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace eld {
+
+/// Creates a dense table indexed by relocation type from a list of
+/// (type, entry) pairs, such as the ones produced by the
+/// *RelocationFunctions.h lists. Types that are not in the list get a value
+/// initialized entry. All types in the list must be less than NumRelocs.
+///
+/// The function is constexpr so that targets with constant entries can build
+/// the table at compile time.
+template <class Entry, size_t NumRelocs, size_t NumEntries>
+constexpr std::array<Entry, NumRelocs>
+createRelocationTable(const std::pair<uint32_t, Entry> (&List)[NumEntries]) {
+  std::array<Entry, NumRelocs> Table{};
+  for (size_t I = 0; I != NumEntries; ++I)
+    Table[List[I].first] = List[I].second;
+  return Table;
+}
+
+} // namespace eld
+
+#endif
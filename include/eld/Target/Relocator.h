@@ -14,12 +14,15 @@
 #define ELD_TARGET_RELOCATOR_H
 
 #include "eld/Core/Module.h"
+#include "eld/PluginAPI/DiagnosticEntry.h"
 #include "eld/Readers/Relocation.h"
 #include "llvm/ADT/DenseSet.h"
 #include "llvm/ADT/StringMap.h"
 #include "llvm/ADT/StringRef.h"
+#include <memory>
 #include <mutex>
 #include <unordered_set>
+#include <vector>
 
 namespace eld {
 
@@ -99,16 +102,28 @@ public:
 
   virtual uint32_t getAddend(const Relocation *R) const { return R->addend(); }
 
+  /// Diagnostics collected while relocation sections are handled on several
+  /// threads. They are raised afterwards, in input order.
+  typedef std::vector<std::unique_ptr<plugin::DiagnosticEntry>> DiagnosticList;
+
+  /// The trace diagnostics below are appended to Diagnostics if it is set,
+  /// and raised right away otherwise.
   virtual void traceMergeStrings(const ELFSection *RelocationSection,
                                  const Relocation *R,
                                  const MergeableString *From,
-                                 const MergeableString *To) const;
+                                 const MergeableString *To,
+                                 DiagnosticList *Diagnostics = nullptr) const;
 
   virtual std::pair<Fragment *, uint64_t>
   findFragmentForMergeStr(const ELFSection *RelocationSection,
-                          const Relocation *R, MergeStringFragment *F) const;
-
-  virtual bool doMergeStrings(ELFSection *S);
+                          const Relocation *R, MergeStringFragment *F,
+                          DiagnosticList *Diagnostics = nullptr) const;
+
+  /// Points the merge string relocations of the relocation section S to the
+  /// strings that they were merged with. Only the relocations of S are
+  /// modified, so distinct relocation sections can be handled concurrently.
+  virtual bool doMergeStrings(ELFSection *S,
+                              DiagnosticList *Diagnostics = nullptr);
 
   // ------ observers -----//
   virtual GNULDBackend &getTarget() = 0;
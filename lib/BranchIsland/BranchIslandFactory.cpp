@@ -23,6 +23,7 @@
 #include "eld/Support/RegisterTimer.h"
 #include "eld/Target/Relocator.h"
 #include "llvm/Support/Timer.h"
+#include <algorithm>
 #include <sstream>
 #include <string>
 
@@ -51,28 +52,33 @@ BranchIsland *BranchIslandFactory::findBranchIsland(Module &PModule,
       PModule.findCanReuseTrampolinesForSymbol(SymName))
     return nullptr;
 
-  std::vector<BranchIsland *> Islands =
+  const std::vector<BranchIsland *> &Islands =
       OutputSection->getBranchIslandsForSymbol(PReloc.symInfo());
 
   if (!Islands.size())
     return nullptr;
 
+  // Islands are sorted by address, so the reachable ones form a window around
+  // the place. Skip the islands below the window with a binary search, and
+  // return the lowest reachable island that can be reused.
+  int64_t Place = PReloc.place(PModule);
   int64_t Offset = 0;
-  std::vector<std::pair<BranchIsland *, int64_t>> BranchIslandWithOffsetsVector;
-
-  for (auto &I : Islands) {
-    if ((S->isRelocInRange(&PReloc, I->branchIslandAddr(PModule), Offset,
-                           PModule)) &&
-        (I->canReuseBranchIsland(PReloc.symInfo(), Addend, UseAddends, S))) {
-      BranchIslandWithOffsetsVector.push_back(std::make_pair(I, Offset));
+  auto It = std::partition_point(
+      Islands.begin(), Islands.end(), [&](BranchIsland *I) {
+        int64_t Addr = I->branchIslandAddr(PModule);
+        return Addr < Place &&
+               !S->isRelocInRange(&PReloc, Addr, Offset, PModule);
+      });
+  for (auto Ie = Islands.end(); It != Ie; ++It) {
+    BranchIsland *I = *It;
+    int64_t Addr = I->branchIslandAddr(PModule);
+    if (!S->isRelocInRange(&PReloc, Addr, Offset, PModule)) {
+      if (Addr >= Place)
+        break;
+      continue;
     }
-  }
-  if (BranchIslandWithOffsetsVector.size()) {
-    auto BranchIsland = *std::min_element(
-        BranchIslandWithOffsetsVector.cbegin(),
-        BranchIslandWithOffsetsVector.cend(),
-        [](const auto &B1, const auto &B2) { return B1.second < B2.second; });
-    return BranchIsland.first;
+    if (I->canReuseBranchIsland(PReloc.symInfo(), Addend, UseAddends, S))
+      return I;
   }
   return nullptr;
 }
@@ -220,7 +226,7 @@ BranchIslandFactory::createBranchIsland(Relocation &PReloc, Stub *S,
            It != Ie; ++It) {
         Relocation *Reloc = Relocation::Create(
             (*It)->type(), PRelocator->getSize((*It)->type()),
-            make<FragmentRef>(*Clone, (*It)->offset()),
+            FragmentRef(*Clone, (*It)->offset()),
             (*It)->addend() + RelocAddend);
         Reloc->setSymInfo(PReloc.symInfo());
         Island->addRelocation(*Reloc);
@@ -329,6 +335,7 @@ BranchIslandFactory::createBranchIsland(Relocation &PReloc, Stub *S,
       F->getOwningSection()->setMatchedLinkerScriptRule(MatchedRule);
 
     MatchedSection->splice(CurNodeIter, ToBeInsertedFrags);
+    OutputElfSection->getOutputSection()->setLayoutDirty();
     Symbol->resolveInfo()->setResolvedOrigin(TrampolineInput);
 
     if (LayoutInfo && !LayoutInfo->showOnlyLayout()) {
@@ -339,8 +346,8 @@ BranchIslandFactory::createBranchIsland(Relocation &PReloc, Stub *S,
       LayoutInfo->recordTrampolines();
     }
 
-    OutputElfSection->getOutputSection()->addBranchIsland(PReloc.symInfo(),
-                                                          Island);
+    OutputElfSection->getOutputSection()->addBranchIsland(
+        PModule, PReloc.symInfo(), Island);
     Island->saveTrampolineInfo(PReloc, RelocAddend);
 
     // Add the branch island to the output section.
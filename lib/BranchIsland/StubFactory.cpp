@@ -36,24 +36,14 @@ StubFactory::~StubFactory() {}
 
 void StubFactory::registerStub(Stub *PStub) { Stubs.emplace_back(PStub); }
 
-/// create - create a stub if needed, otherwise return nullptr
-std::pair<BranchIsland *, bool>
-StubFactory::create(Relocation &PReloc, eld::IRBuilder &PBuilder,
-                    BranchIslandFactory &PBrIslandFactory,
-                    GNULDBackend &PBackend) {
-  DiagnosticEngine *DiagEngine = PBackend.config().getDiagEngine();
-  // If the target has not registered a stub to check relocations
-  // against, we cannot create a stub.
-  if (Stubs.empty()) {
-    assert(0 && "target is calling relaxation without a stub registered");
-    return std::make_pair(nullptr, false);
-  }
-
-  int64_t TargetSymbolValue = 0;
+Stub *StubFactory::findStub(Relocation &PReloc, Module &PModule,
+                            GNULDBackend &PBackend,
+                            int64_t &TargetSymbolValue) const {
+  TargetSymbolValue = 0;
 
   LDSymbol *Symbol = PReloc.symInfo()->outSymbol();
   if (Symbol->hasFragRef()) {
-    uint64_t Value = Symbol->fragRef()->getOutputOffset(PBuilder.getModule());
+    uint64_t Value = Symbol->fragRef()->getOutputOffset(PModule);
     uint64_t Addr = Symbol->fragRef()->getOutputELFSection()->addr();
     TargetSymbolValue = Addr + Value;
   } else
@@ -62,7 +52,7 @@ StubFactory::create(Relocation &PReloc, eld::IRBuilder &PBuilder,
   Stub *Stub = PBackend.getBranchIslandStub(&PReloc, TargetSymbolValue);
 
   if (!Stub)
-    return std::make_pair(nullptr, false);
+    return nullptr;
 
   // We need to explicitly check the range for PLT slot if the stub supports
   // PIC code and we have a slot for it in PLT
@@ -70,9 +60,38 @@ StubFactory::create(Relocation &PReloc, eld::IRBuilder &PBuilder,
     TargetSymbolValue = PBackend.getPLTAddr(PReloc.symInfo());
 
   int64_t Offset = 0;
-  if (!Stub->isNeeded(&PReloc, TargetSymbolValue, PBuilder.getModule()) &&
-      Stub->isRelocInRange(&PReloc, TargetSymbolValue, Offset,
-                           PBuilder.getModule()))
+  if (!Stub->isNeeded(&PReloc, TargetSymbolValue, PModule) &&
+      Stub->isRelocInRange(&PReloc, TargetSymbolValue, Offset, PModule))
+    return nullptr;
+  return Stub;
+}
+
+bool StubFactory::isStubNeeded(Relocation &PReloc, Module &PModule,
+                               GNULDBackend &PBackend) const {
+  if (Stubs.empty())
+    return false;
+  int64_t TargetSymbolValue = 0;
+  return findStub(PReloc, PModule, PBackend, TargetSymbolValue) != nullptr;
+}
+
+/// create - create a stub if needed, otherwise return nullptr
+std::pair<BranchIsland *, bool>
+StubFactory::create(Relocation &PReloc, eld::IRBuilder &PBuilder,
+                    BranchIslandFactory &PBrIslandFactory,
+                    GNULDBackend &PBackend) {
+  DiagnosticEngine *DiagEngine = PBackend.config().getDiagEngine();
+  // If the target has not registered a stub to check relocations
+  // against, we cannot create a stub.
+  if (Stubs.empty()) {
+    assert(0 && "target is calling relaxation without a stub registered");
+    return std::make_pair(nullptr, false);
+  }
+
+  int64_t TargetSymbolValue = 0;
+  Stub *Stub =
+      findStub(PReloc, PBuilder.getModule(), PBackend, TargetSymbolValue);
+
+  if (!Stub)
     return std::make_pair(nullptr, false);
 
   std::pair<BranchIsland *, bool> BranchIsland =
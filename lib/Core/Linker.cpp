@@ -770,6 +770,8 @@ bool Linker::emit() {
       ThisConfig->raiseDiagEntry(std::move(ExpPostProcess.error()));
       return false;
     }
+    if (!ThisConfig->getDiagEngine()->diagnose())
+      return false;
 
     // Update Build ID and sync
     eld::Expected<void> E =
@@ -819,9 +819,23 @@ void Module::setRelocationData(const eld::Relocation *R, uint64_t Data) {
 
 bool Module::getRelocationData(const eld::Relocation *R, uint64_t &Data) {
   std::lock_guard<std::mutex> Guard(Mutex);
+  InspectedRelocations.insert(R);
   return getRelocationDataForSync(R, Data);
 }
 
+void Module::recordInspectedRelocationsAsApplied() {
+  std::lock_guard<std::mutex> Guard(Mutex);
+  AppliedRelocations.insert(InspectedRelocations.begin(),
+                            InspectedRelocations.end());
+  for (auto &D : RelocationData)
+    AppliedRelocations.insert(D.first);
+}
+
+bool Module::markRelocationApplied(const eld::Relocation *R) {
+  std::lock_guard<std::mutex> Guard(Mutex);
+  return AppliedRelocations.insert(R).second;
+}
+
 bool Module::getRelocationDataForSync(const eld::Relocation *R,
                                       uint64_t &Data) {
   auto It = RelocationData.find(R);
@@ -12,14 +12,18 @@
 
 
 #include "eld/Fragment/EhFrameHdrFragment.h"
+#include "eld/Config/LinkerConfig.h"
 #include "eld/Core/Module.h"
 #include "eld/Diagnostics/DiagnosticEngine.h"
 #include "eld/Fragment/EhFrameFragment.h"
 #include "eld/Readers/EhFrameHdrSection.h"
+#include "llvm/ADT/STLExtras.h"
 #include "llvm/ADT/Twine.h"
 #include "llvm/BinaryFormat/Dwarf.h"
 #include "llvm/Support/Endian.h"
+#include "llvm/Support/Parallel.h"
 #include <algorithm>
+#include <tuple>
 
 using namespace eld;
 
@@ -54,7 +58,7 @@ eld::Expected<void> EhFrameHdrFragment::emit(MemoryRegion &Mr, Module &M) {
   Buf[1] = llvm::dwarf::DW_EH_PE_pcrel | llvm::dwarf::DW_EH_PE_sdata4;
 
   if (CreateTable) {
-    Fdes = getFdeData(Mr.begin(), M.getConfig().getDiagEngine());
+    Fdes = getFdeData(Mr.begin(), M);
     Buf[2] = llvm::dwarf::DW_EH_PE_udata4;
     Buf[3] = llvm::dwarf::DW_EH_PE_datarel | llvm::dwarf::DW_EH_PE_sdata4;
   } else {
@@ -83,45 +87,75 @@ eld::Expected<void> EhFrameHdrFragment::emit(MemoryRegion &Mr, Module &M) {
 }
 
 std::vector<EhFrameHdrFragment::FdeData>
-EhFrameHdrFragment::getFdeData(uint8_t *Data, DiagnosticEngine *DiagEngine) {
-  std::vector<FdeData> Ret;
-  uint64_t VA = getOwningSection()->getOutputELFSection()->addr();
+EhFrameHdrFragment::getFdeData(uint8_t *Data, Module &M) {
+  const LinkerConfig &Config = M.getConfig();
+  DiagnosticEngine *DiagEngine = Config.getDiagEngine();
+  bool UseThreads =
+      Config.options().numThreads() > 1 && Config.isEhFrameMultiThreaded();
+
+  // Give every FDE a fixed slot in CIE order, so that the PCs can be read
+  // independently of each other.
+  std::vector<std::pair<FDEFragment *, uint8_t>> FDEs;
+  FDEs.reserve(
+      llvm::dyn_cast<eld::EhFrameHdrSection>(getOwningSection())->getNumFDE());
   for (CIEFragment *CIE :
        llvm::dyn_cast<eld::EhFrameHdrSection>(getOwningSection())->getCIEs()) {
     uint8_t Enc = CIE->getFdeEncoding(Is64Bit, DiagEngine);
-    for (FDEFragment *FDE : CIE->getFDEs()) {
-      uint64_t PC = getFdePc(Data, FDE, Enc, DiagEngine);
-      uint64_t FdeVA = FDE->getOwningSection()->getOutputELFSection()->addr() +
-                       FDE->getOffset(DiagEngine);
-      // With noinhbit-exec there may be an issue that the VA might not fit,
-      // just because the symbol is not resolved.
-      if (!llvm::isInt<32>(PC - VA)) {
-        DiagEngine->raise(Diag::eh_frame_read_warn)
-            << "PC Offset is too large in " +
-                   std::string(FDE->getOwningSection()->name())
-            << FDE->getOwningSection()
-                   ->getInputFile()
-                   ->getInput()
-                   ->decoratedPath();
-      }
-      Ret.push_back({uint32_t(PC - VA), uint32_t(FdeVA - VA)});
-    }
+    for (FDEFragment *FDE : CIE->getFDEs())
+      FDEs.push_back(std::make_pair(FDE, Enc));
+  }
+
+  struct Entry {
+    FdeData Fde;
+    uint32_t Index;
+  };
+  std::vector<Entry> Entries(FDEs.size());
+  std::vector<uint8_t> IsTooLarge(FDEs.size(), 0);
+  uint64_t VA = getOwningSection()->getOutputELFSection()->addr();
+  auto ReadFde = [&](size_t I) {
+    FDEFragment *FDE = FDEs[I].first;
+    uint64_t PC = getFdePc(Data, FDE, FDEs[I].second, DiagEngine);
+    uint64_t FdeVA = FDE->getOwningSection()->getOutputELFSection()->addr() +
+                     FDE->getOffset(DiagEngine);
+    // With noinhbit-exec there may be an issue that the VA might not fit,
+    // just because the symbol is not resolved.
+    IsTooLarge[I] = !llvm::isInt<32>(PC - VA);
+    Entries[I] = {{uint32_t(PC - VA), uint32_t(FdeVA - VA)}, uint32_t(I)};
+  };
+  if (UseThreads)
+    llvm::parallelFor(0, FDEs.size(), ReadFde);
+  else
+    for (size_t I = 0, E = FDEs.size(); I != E; ++I)
+      ReadFde(I);
+
+  // Raise the warnings in FDE order.
+  for (size_t I = 0, E = FDEs.size(); I != E; ++I) {
+    if (!IsTooLarge[I])
+      continue;
+    ELFSection *S = FDEs[I].first->getOwningSection();
+    DiagEngine->raise(Diag::eh_frame_read_warn)
+        << "PC Offset is too large in " + std::string(S->name())
+        << S->getInputFile()->getInput()->decoratedPath();
   }
 
   // Sort the FDE list by their PC and uniqueify. Usually there is only
   // one FDE for a PC (i.e. function), but if ICF merges two functions
   // into one, there can be more than one FDEs pointing to the address.
-  auto Less = [](const FdeData &A, const FdeData &B) {
-    return A.PcRel < B.PcRel;
-  };
-
-  std::stable_sort(Ret.begin(), Ret.end(), Less);
-  auto Eq = [](const FdeData &A, const FdeData &B) {
-    return A.PcRel == B.PcRel;
+  // Ties are broken by the FDE slot, so that the first FDE in CIE order is
+  // kept, whether or not the list is sorted in parallel.
+  auto Less = [](const Entry &A, const Entry &B) {
+    return std::tie(A.Fde.PcRel, A.Index) < std::tie(B.Fde.PcRel, B.Index);
   };
+  if (UseThreads)
+    llvm::parallelSort(Entries, Less);
+  else
+    llvm::sort(Entries, Less);
 
-  Ret.erase(std::unique(Ret.begin(), Ret.end(), Eq), Ret.end());
-
+  std::vector<FdeData> Ret;
+  Ret.reserve(Entries.size());
+  for (const Entry &E : Entries)
+    if (Ret.empty() || Ret.back().PcRel != E.Fde.PcRel)
+      Ret.push_back(E.Fde);
   return Ret;
 }
 
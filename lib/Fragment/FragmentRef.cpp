@@ -50,7 +50,8 @@ void FragmentRef::memcpy(void *PDest, size_t PNBytes, Offset POffset) const {
   unsigned int TotalOffset = ThisOffset + POffset;
   switch (ThisFragment->getKind()) {
   /// FIXME: there is lots of unecessary code duplication here
-  case Fragment::MergeString: {
+  case Fragment::MergeString:
+  case Fragment::MergeConstant: {
     auto *Strings = static_cast<MergeStringFragment *>(ThisFragment);
     unsigned int TotalLength = Strings->size();
     if (TotalLength < (TotalOffset + PNBytes))
@@ -123,18 +124,12 @@ FragmentRef::Offset FragmentRef::getOutputOffset(Module &M) const {
     // Find the proper piece
     EhFrameSection *S =
         llvm::dyn_cast<eld::EhFrameSection>(ThisFragment->getOwningSection());
-    std::vector<EhFramePiece> &Pieces = S->getPieces();
-    size_t I = 0;
-    while (I != Pieces.size() &&
-           Pieces[I].getOffset() + Pieces[I].getSize() <= ThisOffset)
-      ++I;
-    if (I == Pieces.size())
-      return ThisOffset + Pieces.back().getOutputOffset() -
-             Pieces.back().getOffset();
-
-    if (!Pieces[I].hasOutputOffset())
+    EhFramePiece *P = S->findPiece(ThisOffset);
+    assert(P);
+    bool IsPastEnd = ThisOffset >= P->getOffset() + P->getSize();
+    if (!IsPastEnd && !P->hasOutputOffset())
       return -1;
-    return ThisOffset + Pieces[I].getOutputOffset() - Pieces[I].getOffset();
+    return ThisOffset + P->getOutputOffset() - P->getOffset();
   }
   /// Correct the output offset for merged strings
   if (ThisFragment->isMergeStr()) {
@@ -151,7 +146,7 @@ FragmentRef::Offset FragmentRef::getOutputOffset(Module &M) const {
       assert(S->Exclude);
       assert(!Merged->Exclude);
       assert(Merged->hasOutputOffset());
-      return Merged->OutputOffset + OffsetInString;
+      return Merged->OutputOffset + Merged->getSuffixOffset(S) + OffsetInString;
     }
     assert(!S->Exclude);
     assert(S->hasOutputOffset());
@@ -0,0 +1,54 @@
+//===- MergeConstantFragment.cpp-------------------------------------------===//
+// Part of the eld Project, under the BSD License
+// See https://github.com/qualcomm/eld/LICENSE.txt for license information.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+
+#include "eld/Fragment/MergeConstantFragment.h"
+#include "eld/Config/LinkerConfig.h"
+#include "eld/Core/Module.h"
+#include "eld/Readers/ELFSection.h"
+#include "llvm/ADT/StringExtras.h"
+#include <algorithm>
+
+using namespace eld;
+
+MergeConstantFragment::MergeConstantFragment(ELFSection *O)
+    : MergeStringFragment(Fragment::MergeConstant, O,
+                          std::max<uint32_t>(O->getAddrAlign(), 1)),
+      EntrySize(O->getEntSize()),
+      // Strings have no salt. The multiplier is odd, so that distinct
+      // alignments never get the same salt.
+      Salt(static_cast<uint32_t>(alignment()) * 0x9E3779B1u) {}
+
+bool MergeConstantFragment::readConstants(LinkerConfig &Config) {
+  llvm::StringRef Contents = getOwningSection()->getContents();
+  ELFSection *S = getOwningSection();
+  if (Contents.size() % EntrySize) {
+    Config.raise(Diag::merge_constant_size_not_multiple)
+        << S->getInputFile()->getInput()->decoratedPath()
+        << S->getDecoratedName(Config.options()) << Contents.size()
+        << EntrySize;
+    return false;
+  }
+  Strings.reserve(Contents.size() / EntrySize);
+  for (uint64_t Offset = 0; Offset < Contents.size(); Offset += EntrySize)
+    addConstant(Config, Contents.substr(Offset, EntrySize), Offset);
+  assert(size() == getOwningSection()->size());
+  return true;
+}
+
+void MergeConstantFragment::addConstant(LinkerConfig &Config,
+                                        llvm::StringRef Constant,
+                                        uint64_t Offset) {
+  Strings.push_back(make<MergeableString>(
+      this, Constant, Offset, std::numeric_limits<uint32_t>::max(), false,
+      MergeableString::hash(Constant, Salt)));
+  if (Config.getPrinter()->isVerbose()) {
+    ELFSection *S = getOwningSection();
+    Config.raise(Diag::splitting_merge_constant_section)
+        << S->getInputFile()->getInput()->decoratedPath()
+        << S->getDecoratedName(Config.options()) << llvm::utohexstr(Offset)
+        << llvm::toHex(Constant, /*LowerCase=*/true) << alignment();
+  }
+}
@@ -8,14 +8,20 @@
 #include "eld/Fragment/MergeStringFragment.h"
 #include "eld/Config/LinkerConfig.h"
 #include "eld/Core/Module.h"
+#include "eld/Fragment/MergeConstantFragment.h"
 #include "eld/LayoutMap/LayoutInfo.h"
 #include "eld/Readers/ELFSection.h"
+#include "llvm/ADT/StringExtras.h"
 
 using namespace eld;
 
 MergeStringFragment::MergeStringFragment(ELFSection *O)
     : Fragment(Fragment::MergeString, O, 1) {}
 
+MergeStringFragment::MergeStringFragment(Fragment::Type Kind, ELFSection *O,
+                                         uint32_t Align)
+    : Fragment(Kind, O, Align) {}
+
 MergeableString *MergeStringFragment::mergeStrings(MergeableString *S,
                                                    OutputSectionEntry *O,
                                                    Module &Module) {
@@ -47,21 +53,45 @@ bool MergeStringFragment::readStrings(LinkerConfig &Config) {
     // account for the null character
     uint64_t Size = End + 1;
     llvm::StringRef String = Contents.slice(0, Size);
-    Strings.push_back(make<MergeableString>(
-        this, String, Offset, std::numeric_limits<uint32_t>::max(), false));
+    addString(Config, String, Offset, MergeableString::hash(String));
     Contents = Contents.drop_front(Size);
-    if (Config.getPrinter()->isVerbose()) {
-      Config.raise(Diag::splitting_merge_string_section)
-          << S->getInputFile()->getInput()->decoratedPath()
-          << S->getDecoratedName(Config.options()) << llvm::utohexstr(Offset)
-          << String.data() << 1;
-    }
     Offset += Size;
   }
   assert(size() == getOwningSection()->size());
   return true;
 }
 
+bool MergeStringFragment::readStrings(LinkerConfig &Config,
+                                      llvm::ArrayRef<uint32_t> StringSizes,
+                                      llvm::ArrayRef<uint32_t> StringHashes) {
+  assert(StringSizes.size() == StringHashes.size());
+  llvm::StringRef Contents = getOwningSection()->getContents();
+  uint64_t Offset = 0;
+  Strings.reserve(StringSizes.size());
+  for (size_t I = 0, E = StringSizes.size(); I != E; ++I) {
+    uint32_t Size = StringSizes[I];
+    addString(Config, Contents.slice(Offset, Offset + Size), Offset,
+              StringHashes[I]);
+    Offset += Size;
+  }
+  assert(size() == getOwningSection()->size());
+  return true;
+}
+
+void MergeStringFragment::addString(LinkerConfig &Config,
+                                    llvm::StringRef String, uint64_t Offset,
+                                    uint32_t Hash) {
+  Strings.push_back(make<MergeableString>(
+      this, String, Offset, std::numeric_limits<uint32_t>::max(), false, Hash));
+  if (Config.getPrinter()->isVerbose()) {
+    ELFSection *S = getOwningSection();
+    Config.raise(Diag::splitting_merge_string_section)
+        << S->getInputFile()->getInput()->decoratedPath()
+        << S->getDecoratedName(Config.options()) << llvm::utohexstr(Offset)
+        << String.data() << 1;
+  }
+}
+
 size_t MergeStringFragment::size() const {
   size_t Size = 0;
   for (const MergeableString *S : Strings)
@@ -122,4 +152,14 @@ void MergeStringFragment::assignOutputOffsets() {
 
 bool MergeableString::isAlloc() const {
   return Fragment->getOwningSection()->isAlloc();
-}
\ No newline at end of file
+}
+
+bool MergeableString::isConstant() const {
+  return llvm::isa<MergeConstantFragment>(Fragment);
+}
+
+std::string MergeableString::getDisplayString() const {
+  if (isConstant())
+    return "0x" + llvm::toHex(String, /*LowerCase=*/true);
+  return String.data();
+}
@@ -7,7 +7,9 @@
 
 #include "eld/Fragment/RegionFragmentEx.h"
 #include "eld/Core/Module.h"
+#include "eld/Object/OutputSectionEntry.h"
 #include "eld/Readers/ELFSection.h"
+#include <algorithm>
 
 using namespace eld;
 
@@ -64,9 +66,104 @@ void RegionFragmentEx::deleteInstruction(uint32_t DeleteOffset,
                Size - DeleteOffset - DeleteSize);
 
   Size = Size - DeleteSize;
+  if (OutputSectionEntry *O = getOwningSection()->getOutputSection())
+    O->setLayoutDirty();
 }
 
-size_t RegionFragmentEx::size() const { return Size; }
+void RegionFragmentEx::addPendingDeletion(uint32_t DeleteOffset,
+                                          uint32_t DeleteSize) {
+  if (DeletedBefore.empty())
+    DeletedBefore.push_back(0);
+  // Deletions are normally recorded in increasing offset order, in which case
+  // this is a plain append.
+  auto It = std::upper_bound(
+      PendingDeletions.begin(), PendingDeletions.end(), DeleteOffset,
+      [](uint32_t Off, const std::pair<uint32_t, uint32_t> &D) {
+        return Off < D.first;
+      });
+  size_t Index = It - PendingDeletions.begin();
+  PendingDeletions.insert(It, {DeleteOffset, DeleteSize});
+  DeletedBefore.resize(PendingDeletions.size() + 1);
+  for (size_t I = Index; I < PendingDeletions.size(); ++I)
+    DeletedBefore[I + 1] = DeletedBefore[I] + PendingDeletions[I].second;
+}
+
+uint32_t RegionFragmentEx::getRelaxedOffset(uint32_t Offset) const {
+  if (PendingDeletions.empty())
+    return Offset;
+  // Only deletions strictly before Offset move it, as in deleteInstruction.
+  auto It = std::lower_bound(
+      PendingDeletions.begin(), PendingDeletions.end(), Offset,
+      [](const std::pair<uint32_t, uint32_t> &D, uint32_t Off) {
+        return D.first < Off;
+      });
+  return Offset - DeletedBefore[It - PendingDeletions.begin()];
+}
+
+uint32_t RegionFragmentEx::getPendingDeletedBytes(uint32_t Begin,
+                                                  uint32_t End) const {
+  if (PendingDeletions.empty() || Begin >= End)
+    return 0;
+  auto Less = [](const std::pair<uint32_t, uint32_t> &D, uint32_t Off) {
+    return D.first < Off;
+  };
+  auto First = std::lower_bound(PendingDeletions.begin(),
+                                PendingDeletions.end(), Begin, Less);
+  auto Last = std::lower_bound(First, PendingDeletions.end(), End, Less);
+  return DeletedBefore[Last - PendingDeletions.begin()] -
+         DeletedBefore[First - PendingDeletions.begin()];
+}
+
+void RegionFragmentEx::applyPendingDeletions() {
+  if (PendingDeletions.empty())
+    return;
+
+  // Fixup relocations.
+  for (auto &Reloc : getOwningSection()->getRelocations()) {
+    FragmentRef *Ref = Reloc->targetRef();
+    FragmentRef::Offset Off = Ref->offset();
+    if (Off < Size)
+      Ref->setOffset(getRelaxedOffset(Off));
+  }
+
+  // Fixup symbols, shrinking any symbol that had bytes deleted inside it.
+  for (ResolveInfo *Info : Symbols) {
+    FragmentRef *Ref = Info->outSymbol()->fragRef();
+    FragmentRef::Offset Off = Ref->offset();
+    if (Off > Size)
+      continue;
+    uint32_t SymbolSize = Info->outSymbol()->size();
+    if (!Info->isSection())
+      Info->outSymbol()->setSize(
+          SymbolSize - getPendingDeletedBytes(Off, Off + SymbolSize));
+    Ref->setOffset(getRelaxedOffset(Off));
+  }
+
+  // Compact the region, moving each kept range only once.
+  char *Buf = const_cast<char *>(Data);
+  uint32_t Out = PendingDeletions.front().first;
+  for (size_t I = 0, E = PendingDeletions.size(); I != E; ++I) {
+    uint32_t KeepBegin =
+        PendingDeletions[I].first + PendingDeletions[I].second;
+    uint32_t KeepEnd = I + 1 != E ? PendingDeletions[I + 1].first : Size;
+    if (KeepEnd > KeepBegin) {
+      std::memmove(Buf + Out, Buf + KeepBegin, KeepEnd - KeepBegin);
+      Out += KeepEnd - KeepBegin;
+    }
+  }
+
+  Size = Size - DeletedBefore.back();
+  PendingDeletions.clear();
+  DeletedBefore.clear();
+  if (OutputSectionEntry *O = getOwningSection()->getOutputSection())
+    O->setLayoutDirty();
+}
+
+size_t RegionFragmentEx::size() const {
+  if (PendingDeletions.empty())
+    return Size;
+  return Size - DeletedBefore.back();
+}
 
 eld::Expected<void> RegionFragmentEx::emit(MemoryRegion &Mr, Module &M) {
   uint8_t *Out = Mr.begin() + getOffset(M.getConfig().getDiagEngine());
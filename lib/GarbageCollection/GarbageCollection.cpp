@@ -31,7 +31,11 @@
 #include "eld/SymbolResolver/LDSymbol.h"
 #include "eld/Target/GNULDBackend.h"
 #include "eld/Target/LDFileFormat.h"
+#include "llvm/ADT/STLExtras.h"
 #include "llvm/Support/Casting.h"
+#include "llvm/Support/ThreadPool.h"
+#include <atomic>
+#include <mutex>
 #include <queue>
 #include <stdlib.h>
 #include <string.h>
@@ -52,6 +56,31 @@ static inline Section *getInputSectionForSymbol(ResolveInfo &PInfo) {
     return PInfo.getOwningSection();
   return nullptr;
 }
+
+/// A fixed-size bit vector whose bits may be set concurrently.
+class AtomicBitVector {
+public:
+  explicit AtomicBitVector(size_t Size) : Words((Size + 63) / 64) {}
+
+  void set(size_t I) {
+    Words[I / 64].fetch_or(bit(I), std::memory_order_relaxed);
+  }
+
+  /// Sets the bit, and returns true if this call changed it.
+  bool testAndSet(size_t I) {
+    return !(Words[I / 64].fetch_or(bit(I), std::memory_order_relaxed) &
+             bit(I));
+  }
+
+  bool test(size_t I) const {
+    return Words[I / 64].load(std::memory_order_relaxed) & bit(I);
+  }
+
+private:
+  static uint64_t bit(size_t I) { return uint64_t(1) << (I % 64); }
+
+  std::vector<std::atomic<uint64_t>> Words;
+};
 } // namespace
 
 /// shouldProcessGC - check if the section kind is handled in GC
@@ -151,48 +180,56 @@ void GarbageCollection::SectionReachedListMap::
     if (findReachedList(*Sect))
       continue;
     // If the bitcode section has already been traversed, just continue;
-    SectionListTy &ReachedSects = getReachedList(*Sect);
-    SymbolListTy &ReachedSyms = getReachedSymbolList(*Sect);
-
-    auto ProcessSym = [&](ResolveInfo *SymInfo) {
-      InputFile *Input = SymInfo->resolvedOrigin();
-      if (!Input->isBitcode()) {
-        if (SymInfo->outSymbol()->hasFragRef()) {
-          ReachedSects.insert(SymInfo->getOwningSection());
-          ReachedSyms.insert(SymInfo->outSymbol());
-        }
-      } else {
-        BitcodeFile *BitcodeFile = llvm::dyn_cast<eld::BitcodeFile>(Input);
-        if (Section *SectionForSymbol =
-                BitcodeFile->getInputSectionForSymbol(*SymInfo)) {
-          ReachedSects.insert(SectionForSymbol);
-          // If the bitcode section has already been traversed, just
-          // continue;
-          if (!findReachedList(*SectionForSymbol))
-            addToWorkQ(SectionForSymbol);
-        }
-      }
-    };
+    getReachedList(*Sect);
+    getReachedSymbolList(*Sect);
 
     auto RefIt = ThisModule.getBitcodeReferencedSymbols().find(Sect);
     if (RefIt == ThisModule.getBitcodeReferencedSymbols().end())
       continue;
 
-    for (const auto &S : RefIt->second) {
-      LDSymbol *Sym = S->outSymbol();
-      // check if this sym is defined in linker script
-      if (Sym->resolveInfo()->outSymbol() &&
-          Sym->resolveInfo()->outSymbol()->scriptDefined()) {
-        if (const Assignment *Assignment =
-                ThisModule.getAssignmentForSymbol(Sym->name())) {
-          std::vector<ResolveInfo *> SymbolsForAssignment;
-          Assignment->getSymbols(SymbolsForAssignment);
-          for (auto &SymInfo : SymbolsForAssignment)
-            ProcessSym(SymInfo);
-        }
-      } else
-        ProcessSym(Sym->resolveInfo());
+    addBitCodeReferences(ThisModule, *Sect, RefIt->second);
+  }
+}
+
+void GarbageCollection::SectionReachedListMap::addBitCodeReferences(
+    Module &ThisModule, Section &From, const std::vector<ResolveInfo *> &Syms) {
+  SectionListTy &ReachedSects = getReachedList(From);
+  SymbolListTy &ReachedSyms = getReachedSymbolList(From);
+
+  auto ProcessSym = [&](ResolveInfo *SymInfo) {
+    InputFile *Input = SymInfo->resolvedOrigin();
+    if (!Input->isBitcode()) {
+      if (SymInfo->outSymbol()->hasFragRef()) {
+        ReachedSects.insert(SymInfo->getOwningSection());
+        ReachedSyms.insert(SymInfo->outSymbol());
+      }
+    } else {
+      BitcodeFile *BitcodeFile = llvm::dyn_cast<eld::BitcodeFile>(Input);
+      if (Section *SectionForSymbol =
+              BitcodeFile->getInputSectionForSymbol(*SymInfo)) {
+        ReachedSects.insert(SectionForSymbol);
+        // If the bitcode section has already been traversed, just
+        // continue;
+        if (!findReachedList(*SectionForSymbol))
+          addToWorkQ(SectionForSymbol);
+      }
     }
+  };
+
+  for (const auto &S : Syms) {
+    LDSymbol *Sym = S->outSymbol();
+    // check if this sym is defined in linker script
+    if (Sym->resolveInfo()->outSymbol() &&
+        Sym->resolveInfo()->outSymbol()->scriptDefined()) {
+      if (const Assignment *Assignment =
+              ThisModule.getAssignmentForSymbol(Sym->name())) {
+        std::vector<ResolveInfo *> SymbolsForAssignment;
+        Assignment->getSymbols(SymbolsForAssignment);
+        for (auto &SymInfo : SymbolsForAssignment)
+          ProcessSym(SymInfo);
+      }
+    } else
+      ProcessSym(Sym->resolveInfo());
   }
 }
 
@@ -207,18 +244,21 @@ GarbageCollection::GarbageCollection(LinkerConfig &Config,
 GarbageCollection::~GarbageCollection() {}
 
 bool GarbageCollection::run(const std::string &Phase, bool CommonSectionsOnly) {
+  bool Incremental = canRunIncrementally();
+  WorkListTy WorkList;
   // 1. traverse all the relocations to set up the reached sections of each
-  // section
+  // section. If the reached sections of the earlier run are still valid, only
+  // add the references added since then.
   {
     eld::RegisterTimer T("Get Reachable Sections", "Garbage Collection",
                          ThisConfig.options().printTimingStats());
-
-    setUpReachedSectionsAndSymbols();
-    MBackend.setUpReachedSectionsForGC(MSectionReachedListMap);
+    if (Incremental)
+      addNewReferencedSymbols(WorkList);
+    else
+      buildReachedSections();
   }
 
   SectionSetTy Entry;
-  SectionSetTy LiveSet;
   {
     eld::RegisterTimer T("Compute Entry Sections", "Garbage Collection",
                          ThisConfig.options().printTimingStats());
@@ -227,24 +267,137 @@ bool GarbageCollection::run(const std::string &Phase, bool CommonSectionsOnly) {
       return false;
   }
 
+  // An entry section of the earlier run that is no longer an entry section
+  // may make sections dead, and the earlier run cannot be updated.
+  if (Incremental && !llvm::all_of(MEntrySections, [&](Section *S) {
+        return Entry.count(S);
+      })) {
+    Incremental = false;
+    WorkList = WorkListTy();
+    eld::RegisterTimer T("Get Reachable Sections", "Garbage Collection",
+                         ThisConfig.options().printTimingStats());
+    buildReachedSections();
+  }
+
   {
     eld::RegisterTimer T("Find Dead Code", "Garbage Collection",
                          ThisConfig.options().printTimingStats());
     // 3. find all the referenced sections those can be reached by entry
     if (ThisModule.getPrinter()->traceGCLive())
       ThisConfig.raise(Diag::tracing_gc_phase) << Phase;
-    findReferencedSectionsAndSymbols(Entry, LiveSet);
+    if (Incremental) {
+      size_t NumNewReferences = WorkList.size();
+      for (Section *S : Entry) {
+        if (!MEntrySections.insert(S).second)
+          continue;
+        WorkList.push(std::make_pair(S, nullptr));
+        MLiveSet.insert(S);
+      }
+      if (ThisModule.getPrinter()->isVerbose())
+        ThisConfig.raise(Diag::verbose_gc_incremental)
+            << Phase << NumNewReferences;
+      walkReferencedSections(WorkList, MEntrySections, MLiveSet);
+    } else {
+      MEntrySections = std::move(Entry);
+      findReferencedSectionsAndSymbols(MEntrySections, MLiveSet);
+    }
   }
 
   // 4. stripSections - set the unreached sections to Ignore
   {
     eld::RegisterTimer T("Apply Dead Code Elimination", "Garbage Collection",
                          ThisConfig.options().printTimingStats());
-    stripSections(LiveSet, CommonSectionsOnly);
+    stripSections(MLiveSet, CommonSectionsOnly);
   }
+  MHasRun = true;
   return true;
 }
 
+void GarbageCollection::buildReachedSections() {
+  MSectionReachedListMap = SectionReachedListMap();
+  MReferencedSections.clear();
+  MEntrySections.clear();
+  MLiveSet.clear();
+  MNumSeenReferences.clear();
+
+  setUpReachedSectionsAndSymbols();
+  MBackend.setUpReachedSectionsForGC(MSectionReachedListMap);
+
+  MReachabilityInputs = getReachabilityInputs();
+  MPluginEditGeneration = ThisModule.getPluginEditGeneration();
+  for (const auto &R : ThisModule.getBitcodeReferencedSymbols())
+    MNumSeenReferences[R.first] = R.second.size();
+}
+
+std::tuple<size_t, size_t, uint64_t>
+GarbageCollection::getReachabilityInputs() const {
+  size_t NumRelocs = 0;
+  uint64_t NumRelocEdits = 0;
+  for (InputFile *I : ThisModule.getObjectList()) {
+    NumRelocEdits += I->getRelocationEdits();
+    ELFObjectFile *ObjFile = llvm::dyn_cast<ELFObjectFile>(I);
+    if (!ObjFile)
+      continue;
+    for (auto &RelocSect : ObjFile->getRelocationSections()) {
+      if (RelocSect->isIgnore() || RelocSect->isDiscard())
+        continue;
+      NumRelocs += RelocSect->getLink()->getRelocations().size();
+    }
+  }
+  return std::make_tuple(ThisModule.getObjectList().size(), NumRelocs,
+                         NumRelocEdits);
+}
+
+bool GarbageCollection::canRunIncrementally() const {
+  if (!MHasRun)
+    return false;
+  // The traces describe the whole reachability map and walk.
+  if (ThisModule.getPrinter()->traceGC() ||
+      ThisModule.getPrinter()->traceGCLive() ||
+      !ThisConfig.options().gcCref().empty())
+    return false;
+  // Plugins may have changed symbols or relocations without changing the
+  // number of relocations.
+  if (ThisModule.getPluginEditGeneration() != MPluginEditGeneration)
+    return false;
+  // Input files or relocations added, removed or retargeted since the
+  // earlier run may remove references, or add references that are only
+  // found by traversing the relocations again.
+  return getReachabilityInputs() == MReachabilityInputs;
+}
+
+void GarbageCollection::addNewReferencedSymbols(WorkListTy &WorkList) {
+  std::vector<Section *> Changed;
+  for (const auto &R : ThisModule.getBitcodeReferencedSymbols()) {
+    size_t &NumSeen = MNumSeenReferences[R.first];
+    if (NumSeen == R.second.size())
+      continue;
+    NumSeen = R.second.size();
+    Section *Sect = const_cast<Section *>(R.first);
+    // The references of a bitcode section are added when the section is first
+    // reached, and only bitcode sections have their references added.
+    if (!Sect->isBitcode() || !MSectionReachedListMap.findReachedList(*Sect))
+      continue;
+    MSectionReachedListMap.addBitCodeReferences(ThisModule, *Sect, R.second);
+    Changed.push_back(Sect);
+  }
+  // Add the references of the bitcode sections reached for the first time.
+  MSectionReachedListMap.findReachedBitCodeSectionsAndSymbols(ThisModule);
+
+  // The sections reached from a referenced section are live, and are walked
+  // from.
+  for (Section *Sect : Changed) {
+    if (!MReferencedSections.count(Sect))
+      continue;
+    for (Section *To : *MSectionReachedListMap.findReachedList(*Sect)) {
+      if (MReferencedSections.count(To))
+        continue;
+      WorkList.push(std::make_pair(To, Sect));
+      MLiveSet.insert(To);
+    }
+  }
+}
+
 void GarbageCollection::setUpReachedSectionsAndSymbols() {
   // traverse all the input relocations to setup the reached sections
   Module::obj_iterator Input, InEnd = ThisModule.objEnd();
@@ -626,77 +779,214 @@ bool GarbageCollection::getEntrySections(SectionSetTy &EntrySections) {
 
 void GarbageCollection::findReferencedSectionsAndSymbols(
     SectionSetTy &EntrySections, SectionSetTy &LiveSet) {
-  // list of sections waiting to be processed
-  typedef std::queue<std::pair<Section *, Section *>> WorkListTy;
-  WorkListTy WorkList;
-
   if (!EntrySections.size())
     return;
 
+  // The trace prints each section with the section that first reached it,
+  // which depends on the order of the walk. Sections referenced by an earlier
+  // walk are also only known to the serial walk.
+  if (ThisModule.getPrinter()->traceGCLive() || !MReferencedSections.empty()) {
+    findReferencedSectionsSerial(EntrySections, LiveSet);
+    return;
+  }
+  if (ThisConfig.options().numThreads() <= 1 ||
+      !ThisConfig.isMarkLiveSectionsMultiThreaded()) {
+    if (ThisModule.getPrinter()->traceThreads())
+      ThisConfig.raise(Diag::threads_disabled) << "MarkLiveSections";
+    findReferencedSectionsSerial(EntrySections, LiveSet);
+    return;
+  }
+  if (ThisModule.getPrinter()->traceThreads())
+    ThisConfig.raise(Diag::threads_enabled)
+        << "MarkLiveSections" << ThisConfig.options().numThreads();
+  findReferencedSectionsInParallel(EntrySections, LiveSet);
+}
+
+void GarbageCollection::findReferencedSectionsInParallel(
+    SectionSetTy &EntrySections, SectionSetTy &LiveSet) {
+  typedef uint32_t SectionID;
+  const auto &ReachedSections = MSectionReachedListMap.getReachedSections();
+
+  // 1. Assign dense IDs to all the sections of the graph, entry sections
+  // first.
+  std::vector<Section *> Sections;
+  llvm::DenseMap<Section *, SectionID> IDs;
+  auto GetID = [&](Section *S) {
+    auto Res = IDs.try_emplace(S, Sections.size());
+    if (Res.second)
+      Sections.push_back(S);
+    return Res.first->second;
+  };
+  for (Section *S : EntrySections)
+    GetID(S);
+  const SectionID NumEntries = Sections.size();
+  size_t NumEdges = 0;
+  for (const auto &R : ReachedSections) {
+    GetID(R.first);
+    for (Section *S : R.second)
+      GetID(S);
+    NumEdges += R.second.size();
+  }
+  const size_t NumSections = Sections.size();
+
+  // 2. Build the CSR adjacency array. The edges of the section with ID I are
+  // Edges[Offsets[I]] to Edges[Offsets[I + 1] - 1].
+  std::vector<uint32_t> Offsets(NumSections + 1, 0);
+  for (const auto &R : ReachedSections)
+    Offsets[IDs[R.first] + 1] = R.second.size();
+  for (size_t I = 0; I != NumSections; ++I)
+    Offsets[I + 1] += Offsets[I];
+  std::vector<SectionID> Edges(NumEdges);
+  for (const auto &R : ReachedSections) {
+    SectionID *E = Edges.data() + Offsets[IDs[R.first]];
+    for (Section *S : R.second)
+      *E++ = IDs[S];
+  }
+
+  llvm::ThreadPoolInterface *Pool = ThisModule.getThreadPool();
+  const size_t NumThreads = ThisConfig.options().numThreads();
+  // Runs Fn(Begin, End) over [0, N) in chunks. Small ranges are not worth
+  // the synchronization and run on the calling thread.
+  auto ForEachChunk = [&](size_t N, auto Fn) {
+    const size_t MinChunkSize = 1024;
+    size_t ChunkSize = std::max(MinChunkSize, N / (NumThreads * 4) + 1);
+    if (N <= ChunkSize) {
+      Fn(0, N);
+      return;
+    }
+    for (size_t Begin = 0; Begin < N; Begin += ChunkSize) {
+      size_t End = std::min(N, Begin + ChunkSize);
+      Pool->async([=] { Fn(Begin, End); });
+    }
+    Pool->wait();
+  };
+
+  // 3. Find the sections that may be walked from. A section listed as KEEP in
+  // a discarded rule also needs to be checked for references from that
+  // section, and those references may need to be kept.
+  std::vector<uint8_t> MayWalk(NumSections, 1);
+  ForEachChunk(NumSections, [&](size_t Begin, size_t End) {
+    for (size_t I = Begin; I != End; ++I) {
+      ELFSection *ElfSect = dyn_cast<ELFSection>(Sections[I]);
+      if (ElfSect && !mayProcessGC(*ElfSect) &&
+          !(ElfSect->isIgnore() && I < NumEntries))
+        MayWalk[I] = 0;
+    }
+  });
+
+  // 4. Walk the graph one frontier at a time. A section is live if it is an
+  // entry section or is reached from a referenced section, and is referenced
+  // if it is live and may be walked from.
+  AtomicBitVector Live(NumSections);
+  AtomicBitVector Referenced(NumSections);
+  std::vector<SectionID> Frontier;
+  for (SectionID I = 0; I != NumEntries; ++I) {
+    Live.set(I);
+    if (MayWalk[I] && Referenced.testAndSet(I))
+      Frontier.push_back(I);
+  }
+  std::mutex Mutex;
+  while (!Frontier.empty()) {
+    std::vector<SectionID> Next;
+    ForEachChunk(Frontier.size(), [&](size_t Begin, size_t End) {
+      std::vector<SectionID> LocalNext;
+      for (size_t F = Begin; F != End; ++F) {
+        SectionID From = Frontier[F];
+        for (uint32_t E = Offsets[From]; E != Offsets[From + 1]; ++E) {
+          SectionID To = Edges[E];
+          Live.set(To);
+          if (MayWalk[To] && Referenced.testAndSet(To))
+            LocalNext.push_back(To);
+        }
+      }
+      std::lock_guard<std::mutex> Guard(Mutex);
+      Next.insert(Next.end(), LocalNext.begin(), LocalNext.end());
+    });
+    Frontier = std::move(Next);
+  }
+
+  for (size_t I = 0; I != NumSections; ++I) {
+    if (Live.test(I))
+      LiveSet.insert(Sections[I]);
+    if (Referenced.test(I))
+      MReferencedSections.insert(Sections[I]);
+  }
+}
+
+void GarbageCollection::findReferencedSectionsSerial(
+    SectionSetTy &EntrySections, SectionSetTy &LiveSet) {
+  // list of sections waiting to be processed
+  WorkListTy WorkList;
+
   // start from each entry, resolve the transitive closure
   for (const auto &EntryIt : EntrySections) {
     // add entry point to work list
     WorkList.push(std::make_pair(EntryIt, nullptr));
     LiveSet.insert(EntryIt);
+    walkReferencedSections(WorkList, EntrySections, LiveSet);
+  }
+}
 
-    // add section from the work_list to the referencedSections until every
-    // reached sections are added
-    while (!WorkList.empty()) {
-      std::pair<Section *, Section *> P = WorkList.front();
-      WorkList.pop();
-
-      Section *Sect = P.first;
-
-      if (ELFSection *ElfSect = dyn_cast<ELFSection>(Sect)) {
-        // A section listed as KEEP in a discarded rule also needs to be checked
-        // for references from that section, and those references may need to be
-        // kept
-        if (!mayProcessGC(*ElfSect) &&
-            !(ElfSect->isIgnore() && EntrySections.count(ElfSect)))
-          continue;
-      }
-
-      // add section to the ReferencedSections, if the section has been put into
-      // referencedSections, skip this section
-      if (!MReferencedSections.insert(Sect).second)
+void GarbageCollection::walkReferencedSections(
+    WorkListTy &WorkList, const SectionSetTy &EntrySections,
+    SectionSetTy &LiveSet) {
+  // add section from the work_list to the referencedSections until every
+  // reached sections are added
+  while (!WorkList.empty()) {
+    std::pair<Section *, Section *> P = WorkList.front();
+    WorkList.pop();
+
+    Section *Sect = P.first;
+
+    if (ELFSection *ElfSect = dyn_cast<ELFSection>(Sect)) {
+      // A section listed as KEEP in a discarded rule also needs to be checked
+      // for references from that section, and those references may need to be
+      // kept
+      if (!mayProcessGC(*ElfSect) &&
+          !(ElfSect->isIgnore() && EntrySections.count(ElfSect)))
         continue;
+    }
 
-      if (ThisModule.getPrinter()->traceGCLive()) {
-        ThisConfig.raise(Diag::refers_to)
-            << Sect->getDecoratedName(ThisConfig.options());
-        if (Sect->getInputFile())
+    // add section to the ReferencedSections, if the section has been put into
+    // referencedSections, skip this section
+    if (!MReferencedSections.insert(Sect).second)
+      continue;
+
+    if (ThisModule.getPrinter()->traceGCLive()) {
+      ThisConfig.raise(Diag::refers_to)
+          << Sect->getDecoratedName(ThisConfig.options());
+      if (Sect->getInputFile())
+        ThisConfig.raise(Diag::referenced_input_file)
+            << Sect->getInputFile()->getInput()->decoratedPath();
+      if (Sect->getOldInputFile())
+        ThisConfig.raise(Diag::referenced_bc_file)
+            << Sect->getOldInputFile()->getInput()->decoratedPath();
+      if (!P.second)
+        ThisConfig.raise(Diag::referenced_by_root_symbol);
+      else {
+        ThisConfig.raise(Diag::referenced_by)
+            << P.second->getDecoratedName(ThisConfig.options());
+        if (P.second->getInputFile())
           ThisConfig.raise(Diag::referenced_input_file)
-              << Sect->getInputFile()->getInput()->decoratedPath();
-        if (Sect->getOldInputFile())
+              << P.second->getInputFile()->getInput()->decoratedPath();
+        if (P.second->getOldInputFile())
           ThisConfig.raise(Diag::referenced_bc_file)
-              << Sect->getOldInputFile()->getInput()->decoratedPath();
-        if (!P.second)
-          ThisConfig.raise(Diag::referenced_by_root_symbol);
-        else {
-          ThisConfig.raise(Diag::referenced_by)
-              << P.second->getDecoratedName(ThisConfig.options());
-          if (P.second->getInputFile())
-            ThisConfig.raise(Diag::referenced_input_file)
-                << P.second->getInputFile()->getInput()->decoratedPath();
-          if (P.second->getOldInputFile())
-            ThisConfig.raise(Diag::referenced_bc_file)
-                << P.second->getOldInputFile()->getInput()->decoratedPath();
-        }
+              << P.second->getOldInputFile()->getInput()->decoratedPath();
       }
+    }
 
-      // get the section reached list, if the section do not has one, which
-      // means no referenced between it and other sections, then skip it
-      SectionListTy *ReachList = MSectionReachedListMap.findReachedList(*Sect);
-      if (nullptr == ReachList)
-        continue;
+    // get the section reached list, if the section do not has one, which
+    // means no referenced between it and other sections, then skip it
+    SectionListTy *ReachList = MSectionReachedListMap.findReachedList(*Sect);
+    if (nullptr == ReachList)
+      continue;
 
-      // put the reached sections to work list, skip the one already be in
-      // referencedSections
-      for (const auto &I : *ReachList) {
-        if (MReferencedSections.find(I) == MReferencedSections.end()) {
-          WorkList.push(std::make_pair(I, Sect));
-          LiveSet.insert(I);
-        }
+    // put the reached sections to work list, skip the one already be in
+    // referencedSections
+    for (const auto &I : *ReachList) {
+      if (MReferencedSections.find(I) == MReferencedSections.end()) {
+        WorkList.push(std::make_pair(I, Sect));
+        LiveSet.insert(I);
       }
     }
   }
@@ -580,7 +580,7 @@ void TextLayoutPrinter::printMergeString(MergeableString *S, Module &M) const {
     return;
   }
   if (ThisLayoutInfo->showStrings()) {
-    outputStream() << "[ Contents: " << S->String.data() << "]";
+    outputStream() << "[ Contents: " << S->getDisplayString() << "]";
     outputStream() << "\n";
   }
   for (MergeableString *Merged : ThisLayoutInfo->getMergedStrings(S)) {
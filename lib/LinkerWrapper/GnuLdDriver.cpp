@@ -26,6 +26,7 @@
 #include "eld/LayoutMap/TextLayoutPrinter.h"
 #include "eld/LayoutMap/YamlLayoutPrinter.h"
 #include "eld/Support/MappingFileReader.h"
+#include "eld/Support/Memory.h"
 #include "eld/Support/MsgHandling.h"
 #include "eld/Support/OutputTarWriter.h"
 #include "eld/Support/StringUtils.h"
@@ -120,6 +121,8 @@ bool GnuLdDriver::emitStats(eld::Module &M) const {
   llvm::TimerGroup::printAll(*OutStream);
   llvm::TimerGroup::clearAll();
   M.getLinkerScript().printPluginTimers(*OutStream);
+  if (Config.options().printTimingStats())
+    eld::printArenaStats(*OutStream);
   delete StatsFile;
   return true;
 }
@@ -379,6 +382,17 @@ bool GnuLdDriver::processOptions(llvm::opt::InputArgList &Args) {
   if (Args.hasArg(T::print_timing_stats))
     Config.options().setPrintTimingStats();
 
+  // --stats
+  if (llvm::opt::Arg *arg = Args.getLastArg(T::stats)) {
+    llvm::StringRef value = arg->getValue();
+    if (value != "all") {
+      Config.raise(Diag::invalid_value_for_option)
+          << arg->getOption().getPrefixedName() << arg->getValue();
+      return false;
+    }
+    Config.options().setStats(value);
+  }
+
   // -Bsymbolic
   Config.options().setBsymbolic(Args.hasArg(T::Bsymbolic));
 
@@ -588,6 +602,17 @@ bool GnuLdDriver::processOptions(llvm::opt::InputArgList &Args) {
   Config.addCommandLine(Table->getOptionName(T::no_merge_strings),
                         Args.hasArg(T::no_merge_strings));
 
+  // --merge-strings=<exact|tail>
+  if (llvm::opt::Arg *Arg = Args.getLastArg(T::merge_strings)) {
+    llvm::StringRef Value = Arg->getValue();
+    if (Value != "exact" && Value != "tail") {
+      Config.raise(Diag::invalid_value_for_option)
+          << Arg->getOption().getPrefixedName() << Value;
+      return false;
+    }
+    Config.options().setTailMergeStrings(Value == "tail");
+  }
+
   // --{no-}warn-mismatch
   if (Args.getLastArg(T::no_warn_mismatch))
     Config.options().setWarnMismatch(false);
@@ -951,6 +976,14 @@ bool GnuLdDriver::processOptions(llvm::opt::InputArgList &Args) {
                           std::to_string(numThreads).c_str());
   }
 
+  // --rule-match-cache=<dir>
+  if (llvm::opt::Arg *arg = Args.getLastArg(T::rule_match_cache))
+    Config.options().setRuleMatchingCacheDir(arg->getValue());
+
+  // --apply-relocations-in-place
+  if (Args.hasArg(T::apply_relocations_in_place))
+    Config.options().setApplyRelocationsInPlace();
+
   //
   // SymDef Options.
   //
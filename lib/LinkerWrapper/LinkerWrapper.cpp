@@ -86,6 +86,7 @@ eld::Expected<void> LinkerWrapper::setPreserveSymbol(Symbol Symbol) {
 
   R->shouldPreserve(true);
   R->outSymbol()->setShouldIgnore(false);
+  m_Module.recordPluginEdit();
 
   return {};
 }
@@ -159,6 +160,7 @@ eld::Expected<plugin::Symbol> LinkerWrapper::addSymbol(
   if (InputSection && S->resolveInfo())
     BitcodeFile->setInputSectionForSymbol(*S->resolveInfo(),
                                           *InputSection.getSection());
+  m_Module.recordPluginEdit();
 
   return plugin::Symbol(S->resolveInfo());
 }
@@ -438,6 +440,7 @@ eld::Expected<void> LinkerWrapper::addSymbolToChunk(Chunk &C,
         DiagnosticEntry(Diag::error_failed_to_add_sym_to_chunk, {Symbol}));
   m_Module.addSymbolCreatedByPluginToFragment(C.getFragment(), Symbol, Val,
                                               getPlugin());
+  m_Module.recordPluginEdit();
   return {};
 }
 
@@ -519,6 +522,7 @@ eld::Expected<void> LinkerWrapper::replaceSymbolContent(plugin::Symbol S,
                         {S.getName(), std::to_string(Sz - Sym->size())}));
 
   m_Module.replaceFragment(FragRef, Buf, Sz);
+  m_Module.recordPluginEdit();
 
   return {};
 }
@@ -807,6 +811,7 @@ eld::Expected<void> LinkerWrapper::resetSymbol(plugin::Symbol S, Chunk C) {
   if (!b)
     return std::make_unique<DiagnosticEntry>(
         DiagnosticEntry(Diag::error_failed_to_reset_symbol, {S.getName()}));
+  m_Module.recordPluginEdit();
   return {};
 }
 
@@ -819,6 +824,7 @@ eld::Expected<Use> LinkerWrapper::createAndAddUse(Chunk C, off_t Offset,
       m_Module.getBackend()->getRelocator(), *C.getFragment(), RelocationType,
       *S.getSymbol()->outSymbol(), Offset, Addend);
   C.getFragment()->getOwningSection()->addRelocation(relocation);
+  m_Module.recordPluginEdit();
   return Use(relocation);
 }
 
@@ -831,6 +837,9 @@ eld::Expected<void> LinkerWrapper::getTargetDataForUse(Use &U,
         DiagnosticEntry(Diag::error_invalid_use));
   if (m_Module.getRelocationData(R, Data))
     return {};
+  // With --apply-relocations-in-place, relocations that were not read before
+  // relocation() ran are only applied while writing the output.
+  m_Module.getLinker()->getObjectLinker()->applyRelocationForUse(R);
   Data = R->target();
   return {};
 }
@@ -905,6 +914,7 @@ LinkerWrapper::insertBeforeRule(plugin::OutputSection O,
 void LinkerWrapper::removeSymbolTableEntry(plugin::Symbol S) {
   m_Module.getBackend()->markSymbolForRemoval(S.getSymbol());
   m_Module.getScript().removeSymbolOp(this, &m_Module, S.getSymbol());
+  m_Module.recordPluginEdit();
 }
 
 eld::Expected<std::vector<plugin::Symbol>>
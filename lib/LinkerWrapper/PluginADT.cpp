@@ -449,7 +449,13 @@ Use::Status Use::resetSymbol(plugin::Symbol S) {
     return Use::Status::Error;
   if (!S.getSymbol() || !S.getSymbol()->outSymbol())
     return Use::Status::SymbolDoesNotExist;
+  if (m_Relocation->symInfo() == S.getSymbol())
+    return Use::Status::Ok;
   m_Relocation->setSymInfo(S.getSymbol());
+  // Let garbage collection know that the references of the file changed.
+  eld::Fragment *F = m_Relocation->targetRef()->frag();
+  if (F && F->getOwningSection() && F->getOwningSection()->getInputFile())
+    F->getOwningSection()->getInputFile()->recordRelocationEdit();
   return Use::Status::Ok;
 }
 
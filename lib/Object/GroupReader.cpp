@@ -65,30 +65,28 @@ bool GroupReader::readGroup(InputBuilder::InputIteratorT &CurNode,
     ++CurNode;
   }
 
-  size_t CurNamePoolSize = 0;
-  size_t NewSize = 0;
-  // Traverse all archives in the group.
+  // Traverse all archives in the group. Each archive only looks at its
+  // pending lazy symbols, so stop once a traversal includes no member.
+  uint32_t NumIncluded = 0;
   do {
-    CurNamePoolSize = MModule.getNamePool().getNumGlobalSize();
+    NumIncluded = 0;
     for (Module::lib_iterator
              It = ArchiveLibraryList.begin() + ArchiveLibraryListSize,
              Ie = ArchiveLibraryList.end();
          It != Ie; ++It) {
       if ((*It)->getInput()->getAttribute().isWholeArchive())
         continue;
-      eld::Expected<uint32_t> ExpNumObjects =
-          MObjLinker->getArchiveParser()->parseFile(**It);
-      if (!ExpNumObjects) {
-        PConfig.raise(Diag::error_read_archive)
-            << (*It)->getInput()->decoratedPath();
-        PConfig.raiseDiagEntry(std::move(ExpNumObjects.error()));
-        return false;
-      }
+      ArchiveFile *Archive = llvm::cast<ArchiveFile>(*It);
+      PConfig.raise(Diag::verbose_performing_archive_symbol_resolution)
+          << Archive->getInput()->decoratedPath();
+      if (!Archive->hasPendingSymbols())
+        continue;
+      NumIncluded +=
+          MObjLinker->getArchiveParser()->resolveLazySymbols(*Archive);
     }
-    NewSize = MModule.getNamePool().getNumGlobalSize();
     if (layoutInfo)
       layoutInfo->recordGroup();
-  } while (CurNamePoolSize != NewSize);
+  } while (NumIncluded);
 
   if (layoutInfo)
     layoutInfo->recordInputActions(LayoutInfo::EndGroup, nullptr);
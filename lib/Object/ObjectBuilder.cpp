@@ -22,6 +22,7 @@
 #include "eld/Input/ObjectFile.h"
 #include "eld/Object/ObjectLinker.h"
 #include "eld/Object/RuleContainer.h"
+#include "eld/Object/RuleMatcher.h"
 #include "eld/Object/SectionMap.h"
 #include "eld/PluginAPI/OutputSectionIteratorPlugin.h"
 #include "eld/PluginAPI/SectionIteratorPlugin.h"
@@ -34,12 +35,15 @@
 #include "eld/SymbolResolver/IRBuilder.h"
 #include "eld/Target/GNULDBackend.h"
 #include "eld/Target/LDFileFormat.h"
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/SmallSet.h"
+#include "llvm/ADT/StringExtras.h"
 #include "llvm/Support/Casting.h"
 #include "llvm/Support/Parallel.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/ThreadPool.h"
 #include <algorithm>
+#include <array>
 #include <chrono>
 
 using namespace eld;
@@ -179,8 +183,8 @@ void ObjectBuilder::traceMergeStrings(const MergeableString *From,
   std::string SectionTo = From->Fragment->getOwningSection()->getDecoratedName(
       ThisConfig.options());
   ThisConfig.raise(Diag::merging_fragments)
-      << FileFrom << SectionFrom << FileTo << SectionTo << From->String
-      << OutputSectionName;
+      << FileFrom << SectionFrom << FileTo << SectionTo
+      << From->getDisplayString() << OutputSectionName;
   assert(From->String == To->String);
 }
 
@@ -197,6 +201,98 @@ void ObjectBuilder::mergeStrings(MergeStringFragment *F,
   }
 }
 
+void ObjectBuilder::mergeStringsInParallel(
+    llvm::ArrayRef<MergeStringFragment *> Fragments, OutputSectionEntry *O) {
+  typedef std::array<std::vector<MergeableString *>,
+                     OutputSectionEntry::NumStringShards>
+      ShardedStrings;
+  llvm::ThreadPoolInterface *Pool = module().getThreadPool();
+
+  // Split the fragments into contiguous ranges with about the same number of
+  // strings.
+  size_t NumStrings = 0;
+  for (MergeStringFragment *F : Fragments)
+    NumStrings += F->getStrings().size();
+  size_t NumRanges = config().options().numThreads() * 4;
+  size_t RangeSize = NumStrings / NumRanges + 1;
+  std::vector<llvm::ArrayRef<MergeStringFragment *>> Ranges;
+  size_t Begin = 0, Count = 0;
+  for (size_t I = 0, E = Fragments.size(); I != E; ++I) {
+    Count += Fragments[I]->getStrings().size();
+    if (Count < RangeSize && I + 1 != E)
+      continue;
+    Ranges.push_back(Fragments.slice(Begin, I + 1 - Begin));
+    Begin = I + 1;
+    Count = 0;
+  }
+
+  // 1. Partition the strings of each range by shard, keeping the string
+  // order within each shard.
+  std::vector<ShardedStrings> Partitions(Ranges.size());
+  for (size_t R = 0; R != Ranges.size(); ++R) {
+    Pool->async([&, R] {
+      for (MergeStringFragment *F : Ranges[R])
+        for (MergeableString *S : F->getStrings())
+          Partitions[R][OutputSectionEntry::getStringShard(S)].push_back(S);
+    });
+  }
+  Pool->wait();
+
+  // 2. Merge each shard. Visiting the ranges in order keeps the first of the
+  // identical strings, as merging the fragments one by one does.
+  for (unsigned Shard = 0; Shard != OutputSectionEntry::NumStringShards;
+       ++Shard) {
+    Pool->async([&, Shard] {
+      for (ShardedStrings &Partition : Partitions)
+        for (MergeableString *S : Partition[Shard])
+          if (O->addUniqueString(S) != S)
+            S->exclude();
+    });
+  }
+  Pool->wait();
+
+  for (MergeStringFragment *F : Fragments)
+    O->appendStrings(F->getStrings());
+}
+
+void ObjectBuilder::tailMergeStrings(OutputSectionEntry *O) {
+  // Constants keep their alignment only if they are not tail merged.
+  std::vector<MergeableString *> Strings;
+  for (MergeableString *S : O->getMergeStrings())
+    if (!S->Exclude && !S->isConstant())
+      Strings.push_back(S);
+
+  // Sort the strings by their reversed contents in descending order. The
+  // strings that end with a string S then come right before S, longest
+  // first. Unique strings are distinct, so the order is deterministic.
+  llvm::sort(Strings, [](const MergeableString *A, const MergeableString *B) {
+    llvm::StringRef SA = A->String, SB = B->String;
+    for (size_t I = 1, E = std::min(SA.size(), SB.size()); I <= E; ++I) {
+      unsigned char CA = SA[SA.size() - I], CB = SB[SB.size() - I];
+      if (CA != CB)
+        return CA > CB;
+    }
+    return SA.size() > SB.size();
+  });
+
+  bool Trace = config().getPrinter()->traceMergeStrings() ||
+               config().getPrinter()->isVerbose();
+  // Strings include their null terminator, so a string that ends with S has
+  // S as a suffix.
+  MergeableString *Into = nullptr;
+  MergeableString *Prev = nullptr;
+  for (MergeableString *S : Strings) {
+    if (Prev && Prev->String.ends_with(S->String)) {
+      O->mergeTailString(S, Into);
+      if (Trace)
+        traceMergeStrings(S, Into);
+    } else {
+      Into = S;
+    }
+    Prev = S;
+  }
+}
+
 /// moveSection - move the fragments of pTO section data to pTo
 bool ObjectBuilder::moveSection(ELFSection *PFrom, ELFSection *PTo) {
   assert(PFrom != PTo && "Cannot move section data to itself!");
@@ -262,115 +358,116 @@ void ObjectBuilder::doPluginIterateSections(eld::InputFile *Obj,
 }
 
 void ObjectBuilder::assignInputFromOutput(eld::InputFile *Obj) {
-  std::unordered_map<Section *, bool> RetrySections;
   bool IsPartialLink = (ThisConfig.codeGenType() == LinkerConfig::Object);
   bool IsGnuCompatible =
       (ThisConfig.options().getScriptOption() == GeneralOptions::MatchGNU);
   bool LinkerScriptHasSectionsCommand =
       ThisModule.getScript().linkerScriptHasSectionsCommand();
+  bool CollectStats = ThisModule.getPrinter()->allStats();
   SectionMap &SectionMap = ThisModule.getScript().sectionMap();
+  RuleMatcher &Matcher = SectionMap.getRuleMatcher();
   ObjectFile *ObjFile = llvm::dyn_cast<ObjectFile>(Obj);
   std::vector<Section *> Sections = getInputSectionsForRuleMatching(ObjFile);
-  // For all output sections.
-  for (auto *Out : SectionMap) {
-    // For each input rule.
-    for (auto *In : *Out) {
-      auto Start = std::chrono::system_clock::now();
-      // For each input section.
-      for (Section *Section : Sections) {
-        ELFSection *ELFSect = llvm::dyn_cast<eld::ELFSection>(Section);
-
-        bool IsRetrySect = false;
-
-        // If the section has an already assigned output section, skip.
-        // If the section needs to be retried, we may need to revisit the
-        // section to match the best rule.
-        if (Section->getOutputSection()) {
-          if (!RetrySections.size() ||
-              (RetrySections.find(Section) == RetrySections.end())) {
+  llvm::SmallDenseMap<RuleContainer *, std::chrono::system_clock::duration>
+      MatchTimes;
+  RuleMatcher::CandidateList Candidates;
+  uint64_t NumRuleChecks = 0;
+  // For each input section.
+  for (Section *Section : Sections) {
+    // If the section has an already assigned output section, skip.
+    if (Section->getOutputSection())
+      continue;
+    ELFSection *ELFSect = llvm::dyn_cast<eld::ELFSection>(Section);
+    // Skip sections with merge strings and if there is no linker scripts
+    // provided.
+    if (IsPartialLink && (ELFSect && ELFSect->isMergeStr()) &&
+        !LinkerScriptHasSectionsCommand)
+      continue;
+    InputFile *Input = Obj;
+    bool IsCommonSection = false;
+    if (CommonELFSection *CommonSection =
+            llvm::dyn_cast<CommonELFSection>(Section)) {
+      Input = CommonSection->getOrigin();
+      IsCommonSection = true;
+    }
+    if (Section->getOldInputFile())
+      Input = Section->getOldInputFile();
+    std::string const &PInputFile =
+        Input->getInput()->getResolvedPath().native();
+    std::string const &Name = Input->getInput()->getName();
+    bool IsArchive =
+        Input->isArchive() ||
+        llvm::dyn_cast<eld::ArchiveMemberInput>(Input->getInput());
+    if (!Input->getInput()->isPatternMapInitialized()) {
+      std::lock_guard<std::mutex> Guard(Mutex);
+      Input->getInput()->resize(
+          ThisModule.getScript().getNumWildCardPatterns());
+    }
+    // Hash of all the required things for Match.
+    uint64_t InputFileHash = Input->getInput()->getResolvedPathHash();
+    uint64_t NameHash = Input->getInput()->getArchiveMemberNameHash();
+    std::string SectName = Section->name().str();
+    uint64_t InputSectionHash = Section->sectionNameHash();
+    if (ELFSect) {
+      if (auto OptRThisSectionName =
+              ObjFile->getRuleMatchingSectName(ELFSect->getIndex())) {
+        SectName = OptRThisSectionName.value();
+        InputSectionHash = llvm::hash_combine(SectName);
+      }
+    }
+    // Only the rules with a section pattern that can match the section name
+    // are checked, in linker script order.
+    Matcher.getCandidates(SectName, InputSectionHash, Candidates);
+    NumRuleChecks += Candidates.size();
+    for (uint32_t RuleIdx : Candidates) {
+      OutputSectionEntry *Out = Matcher.getRule(RuleIdx).first;
+      RuleContainer *In = Matcher.getRule(RuleIdx).second;
+      if (ELFSect) {
+        // If the rule needs to match on permissions, skip if the rule doesnot
+        // satisfy.
+        switch (Out->prolog().constraint()) {
+        case OutputSectDesc::NO_CONSTRAINT:
+          break;
+        case OutputSectDesc::ONLY_IF_RO:
+          if (ELFSect->isWritable())
             continue;
-          }
-          IsRetrySect = true;
-        }
-
-        if (ELFSect) {
-          // If the rule needs to match on permissions, skip if the rule doesnot
-          // satisfy.
-          switch (Out->prolog().constraint()) {
-          case OutputSectDesc::NO_CONSTRAINT:
-            break;
-          case OutputSectDesc::ONLY_IF_RO:
-            if (ELFSect->isWritable())
-              continue;
-            break;
-          case OutputSectDesc::ONLY_IF_RW:
-            if (!ELFSect->isWritable())
-              continue;
-            break;
-          }
-        }
-        // Skip sections with merge strings and if there is no linker scripts
-        // provided.
-        if (IsPartialLink && (ELFSect && ELFSect->isMergeStr()) &&
-            !LinkerScriptHasSectionsCommand)
-          continue;
-        InputFile *Input = Obj;
-        bool IsCommonSection = false;
-        if (CommonELFSection *CommonSection =
-                llvm::dyn_cast<CommonELFSection>(Section)) {
-          Input = CommonSection->getOrigin();
-          IsCommonSection = true;
-        }
-        if (Section->getOldInputFile())
-          Input = Section->getOldInputFile();
-        std::string const &PInputFile =
-            Input->getInput()->getResolvedPath().native();
-        std::string const &Name = Input->getInput()->getName();
-        bool IsArchive =
-            Input->isArchive() ||
-            llvm::dyn_cast<eld::ArchiveMemberInput>(Input->getInput());
-        if (!Input->getInput()->isPatternMapInitialized()) {
-          std::lock_guard<std::mutex> Guard(Mutex);
-          Input->getInput()->resize(
-              ThisModule.getScript().getNumWildCardPatterns());
-        }
-        // Hash of all the required things for Match.
-        uint64_t InputFileHash = Input->getInput()->getResolvedPathHash();
-        uint64_t NameHash = Input->getInput()->getArchiveMemberNameHash();
-        std::string SectName = Section->name().str();
-        uint64_t InputSectionHash = Section->sectionNameHash();
-        if (ELFSection *ELFSect = llvm::dyn_cast<ELFSection>(Section)) {
-          if (auto OptRThisSectionName =
-                  ObjFile->getRuleMatchingSectName(ELFSect->getIndex())) {
-            SectName = OptRThisSectionName.value();
-            InputSectionHash = llvm::hash_combine(SectName);
-          }
+          break;
+        case OutputSectDesc::ONLY_IF_RW:
+          if (!ELFSect->isWritable())
+            continue;
+          break;
         }
-        if (SectionMap.matched(*In, Input, PInputFile, SectName, IsArchive,
-                               Name, InputSectionHash, InputFileHash, NameHash,
-                               IsGnuCompatible, IsCommonSection)) {
-          In->incMatchCount();
-          Section->setOutputSection(Out);
-          Section->setMatchedLinkerScriptRule(In);
-          // FIXME: Shouldn't we set ELFSect to LDFileFormat::Discard?
-          if (ELFSect && Out->isDiscard()) {
-            ELFSect->setKind(LDFileFormat::Ignore);
-            if (ThisConfig.options().isSectionTracingRequested() &&
-                ThisConfig.options().traceSection(ELFSect->name().str()))
-              ThisConfig.raise(Diag::discarded_section_info)
-                  << ELFSect->getDecoratedName(ThisConfig.options())
-                  << ObjFile->getInput()->decoratedPath();
-          }
-          if (IsRetrySect && !In->isSpecial())
-            RetrySections.erase(Section);
-          // Retry the match until the closest match is found.
-          if (In->isSpecial())
-            RetrySections.insert(std::make_pair(Section, true));
-        } // end match
-      } // end each input section
-      In->addMatchTime(std::chrono::system_clock::now() - Start);
-    } // end each rule
-  } // end each output section
+      }
+      std::chrono::system_clock::time_point Start;
+      if (CollectStats)
+        Start = std::chrono::system_clock::now();
+      bool Matched = SectionMap.matched(
+          *In, Input, PInputFile, SectName, IsArchive, Name, InputSectionHash,
+          InputFileHash, NameHash, IsGnuCompatible, IsCommonSection);
+      if (CollectStats)
+        MatchTimes[In] += std::chrono::system_clock::now() - Start;
+      if (!Matched)
+        continue;
+      In->incMatchCount();
+      Section->setOutputSection(Out);
+      Section->setMatchedLinkerScriptRule(In);
+      // FIXME: Shouldn't we set ELFSect to LDFileFormat::Discard?
+      if (ELFSect && Out->isDiscard()) {
+        ELFSect->setKind(LDFileFormat::Ignore);
+        if (ThisConfig.options().isSectionTracingRequested() &&
+            ThisConfig.options().traceSection(ELFSect->name().str()))
+          ThisConfig.raise(Diag::discarded_section_info)
+              << ELFSect->getDecoratedName(ThisConfig.options())
+              << ObjFile->getInput()->decoratedPath();
+      }
+      // A special rule is only used if no later rule matches the section.
+      if (!In->isSpecial())
+        break;
+    } // end each candidate rule
+  } // end each input section
+  for (auto &MatchTime : MatchTimes)
+    MatchTime.first->addMatchTime(MatchTime.second);
+  Matcher.addNumRuleChecks(NumRuleChecks);
 }
 
 bool ObjectBuilder::initializePluginsAndProcess(
@@ -472,6 +569,31 @@ void ObjectBuilder::assignOutputSections(std::vector<eld::InputFile *> Inputs,
 
   ThisModule.setState(plugin::LinkerWrapper::BeforeLayout);
 
+  // Index the rules by their section patterns before matching.
+  SectionMap.buildRuleMatcher();
+
+  llvm::StringRef CacheDir = ThisConfig.options().getRuleMatchingCacheDir();
+  if (!CacheDir.empty()) {
+    MRuleMatchCache = std::make_unique<RuleMatchCache>(ThisModule, CacheDir);
+    if (!MRuleMatchCache->init(ThisConfig))
+      MRuleMatchCache.reset();
+    else if (ThisModule.getPrinter()->isVerbose())
+      ThisConfig.raise(Diag::verbose_rule_matching_cache_func_hash)
+          << llvm::utohexstr(MRuleMatchCache->getRulesHash());
+  }
+
+  auto AssignFn = [&](InputFile *Obj) {
+    std::optional<uint64_t> CacheKey;
+    if (matchUsingCache(llvm::dyn_cast<ObjectFile>(Obj), CacheKey))
+      return;
+    Obj->getInput()->resize(ThisModule.getScript().getNumWildCardPatterns());
+    storePatternsForInputFile(Obj, SectionMap);
+    assignInputFromOutput(Obj);
+    Obj->getInput()->clear();
+    if (CacheKey)
+      storeInCache(llvm::cast<ObjectFile>(Obj), *CacheKey);
+  };
+
   std::sort(Inputs.begin(), Inputs.end(), [](InputFile *A, InputFile *B) {
     return A->getNumSections() > B->getNumSections();
   });
@@ -494,10 +616,7 @@ void ObjectBuilder::assignOutputSections(std::vector<eld::InputFile *> Inputs,
       if (ObjFile && HasSectionsCommand && ObjFile->hasHighSectionCount())
         ThisConfig.raise(Diag::more_sections)
             << Obj->getInput()->decoratedPath();
-      Obj->getInput()->resize(ThisModule.getScript().getNumWildCardPatterns());
-      storePatternsForInputFile(Obj, SectionMap);
-      assignInputFromOutput(Obj);
-      Obj->getInput()->clear();
+      AssignFn(Obj);
     }
   } else {
     if (ThisModule.getPrinter()->traceThreads())
@@ -514,13 +633,7 @@ void ObjectBuilder::assignOutputSections(std::vector<eld::InputFile *> Inputs,
       if (ObjFile && HasSectionsCommand && ObjFile->hasHighSectionCount())
         ThisConfig.raise(Diag::more_sections)
             << Obj->getInput()->decoratedPath();
-      Pool->async([&] {
-        Obj->getInput()->resize(
-            ThisModule.getScript().getNumWildCardPatterns());
-        storePatternsForInputFile(Obj, SectionMap);
-        assignInputFromOutput(Obj);
-        Obj->getInput()->clear();
-      });
+      Pool->async([&] { AssignFn(Obj); });
     }
     Pool->wait();
   }
@@ -555,6 +668,16 @@ void ObjectBuilder::printStats() {
       }
     }
   }
+  if (ThisModule.getPrinter()->allStats()) {
+    const RuleMatcher &Matcher = SectionMap.getRuleMatcher();
+    ThisConfig.raise(Diag::linker_script_rule_matcher_stats)
+        << Matcher.getNumExactPatterns() << Matcher.getNumPrefixPatterns()
+        << Matcher.getNumSuffixPatterns() << Matcher.getNumGlobPatterns()
+        << Matcher.getNumRuleChecks();
+    if (MRuleMatchCache)
+      ThisConfig.raise(Diag::linker_script_rule_matching_cache_stats)
+          << MRuleMatchCache->getNumHits() << MRuleMatchCache->getNumMisses();
+  }
 }
 
 // Change kind of section if the section to be merged is different from the one
@@ -856,3 +979,116 @@ ObjectBuilder::getInputSectionsForRuleMatching(ObjectFile *ObjFile) {
 
   return Sections;
 }
+
+bool ObjectBuilder::isSkippedForRuleMatching(const Section *S) {
+  const ELFSection *ELFSect = llvm::dyn_cast<ELFSection>(S);
+  return ELFSect && (ELFSect->getKind() == LDFileFormat::Ignore ||
+                     ELFSect->getKind() == LDFileFormat::Discard);
+}
+
+bool ObjectBuilder::matchUsingCache(ObjectFile *ObjFile,
+                                    std::optional<uint64_t> &Key) {
+  if (!MRuleMatchCache || !ObjFile || ObjFile->isInternal() ||
+      ObjFile->isBitcode() || ObjFile->getContents().empty())
+    return false;
+  // Plugins may change the names used for rule matching; such inputs are
+  // always matched.
+  if (ObjFile->hasRuleMatchingSectionNameMap())
+    return false;
+  // The cache only records the results of matching a fresh input.
+  for (Section *S : ObjFile->getSections()) {
+    if (S->getOutputSection() || S->getOldInputFile() ||
+        llvm::isa<CommonELFSection>(S))
+      return false;
+  }
+  Key = MRuleMatchCache->getKey(*ObjFile);
+  std::optional<std::vector<RuleMatchCache::Entry>> Entries =
+      MRuleMatchCache->read(*Key);
+  const RuleMatcher &Matcher =
+      ThisModule.getScript().sectionMap().getRuleMatcher();
+  auto IsValid = [&]() {
+    if (!Entries || Entries->size() != ObjFile->getSections().size())
+      return false;
+    for (size_t I = 0, E = Entries->size(); I != E; ++I) {
+      const RuleMatchCache::Entry &Entry = (*Entries)[I];
+      Section *S = ObjFile->getSections()[I];
+      if (Entry.NameHash != RuleMatchCache::getNameHash(S->name()))
+        return false;
+      // Group resolution may differ from the link that stored the entry.
+      if (isSkippedForRuleMatching(S) !=
+          static_cast<bool>(Entry.Flags & RuleMatchCache::Skipped))
+        return false;
+      if (Entry.RuleIdx != RuleMatchCache::NoRule &&
+          Entry.RuleIdx >= Matcher.size())
+        return false;
+    }
+    return true;
+  };
+  if (!IsValid()) {
+    MRuleMatchCache->addMiss();
+    return false;
+  }
+  for (size_t I = 0, E = Entries->size(); I != E; ++I) {
+    const RuleMatchCache::Entry &Entry = (*Entries)[I];
+    Section *S = ObjFile->getSections()[I];
+    ELFSection *ELFSect = llvm::dyn_cast<ELFSection>(S);
+    if (ELFSect && (Entry.Flags & (RuleMatchCache::Discarded |
+                                   RuleMatchCache::Skipped))) {
+      if (Entry.Flags & RuleMatchCache::Discarded)
+        ELFSect->setKind(LDFileFormat::Ignore);
+      if (ThisConfig.options().isSectionTracingRequested() &&
+          ThisConfig.options().traceSection(ELFSect->name().str()))
+        ThisConfig.raise(Diag::discarded_section_info)
+            << ELFSect->getDecoratedName(ThisConfig.options())
+            << ObjFile->getInput()->decoratedPath();
+    }
+    if (Entry.RuleIdx == RuleMatchCache::NoRule)
+      continue;
+    const RuleMatcher::Rule &R = Matcher.getRule(Entry.RuleIdx);
+    R.second->incMatchCount();
+    S->setOutputSection(R.first);
+    S->setMatchedLinkerScriptRule(R.second);
+  }
+  MRuleMatchCache->addHit();
+  if (ThisModule.getPrinter()->isVerbose())
+    ThisConfig.raise(Diag::verbose_rule_matching_cache_hit)
+        << MRuleMatchCache->getPath(*Key)
+        << ObjFile->getInput()->decoratedPath();
+  Key.reset();
+  return true;
+}
+
+void ObjectBuilder::storeInCache(ObjectFile *ObjFile, uint64_t Key) {
+  const RuleMatcher &Matcher =
+      ThisModule.getScript().sectionMap().getRuleMatcher();
+  std::vector<RuleMatchCache::Entry> Entries;
+  Entries.reserve(ObjFile->getSections().size());
+  for (Section *S : ObjFile->getSections()) {
+    RuleMatchCache::Entry Entry;
+    Entry.NameHash = RuleMatchCache::getNameHash(S->name());
+    Entry.RuleIdx = RuleMatchCache::NoRule;
+    Entry.Flags = RuleMatchCache::None;
+    if (S->getOutputSection() && S->getMatchedLinkerScriptRule()) {
+      std::optional<uint32_t> RuleIdx =
+          Matcher.getRuleIndex(S->getMatchedLinkerScriptRule());
+      // Do not cache sections matched outside the rule matcher.
+      if (!RuleIdx)
+        return;
+      Entry.RuleIdx = *RuleIdx;
+    }
+    // Only discards caused by the matched rule may be replayed. Sections
+    // that were already ignored, such as preempted group members, are
+    // recorded so that the entry is not used if that changes.
+    if (S->getOutputSection() && S->getOutputSection()->isDiscard())
+      Entry.Flags |= RuleMatchCache::Discarded;
+    else if (isSkippedForRuleMatching(S))
+      Entry.Flags |= RuleMatchCache::Skipped;
+    Entries.push_back(Entry);
+  }
+  if (!MRuleMatchCache->write(Key, Entries))
+    return;
+  if (ThisModule.getPrinter()->isVerbose())
+    ThisConfig.raise(Diag::verbose_rule_matching_cache_write)
+        << MRuleMatchCache->getPath(Key)
+        << ObjFile->getInput()->decoratedPath();
+}
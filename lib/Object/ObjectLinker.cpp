@@ -67,12 +67,14 @@
 #include "llvm/Support/Caching.h"
 #include "llvm/Support/Casting.h"
 #include "llvm/Support/FileOutputBuffer.h"
+#include "llvm/Support/FileSystem.h"
 #include "llvm/Support/MemoryBufferRef.h"
 #include "llvm/Support/Parallel.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/Program.h"
 #include "llvm/Support/ThreadPool.h"
 #include "llvm/Support/raw_ostream.h"
+#include <atomic>
 #include <chrono>
 #include <mutex>
 #include <sstream>
@@ -80,6 +82,10 @@
 using namespace llvm;
 using namespace eld;
 namespace {
+// Output sections with at least this many strings are merged by all the
+// threads instead of one.
+constexpr size_t MinStringsForParallelMerge = 4096;
+
 static DiagnosticEngine *SDiagEngineForLto = nullptr;
 class PrepareDiagEngineForLTO {
 public:
@@ -234,9 +240,99 @@ bool ObjectLinker::readLinkerScript(InputFile *Input) {
   return true;
 }
 
+bool ObjectLinker::decodeInputs(const std::vector<Node *> &InputVector) {
+  if (ThisConfig.options().numThreads() <= 1 ||
+      !ThisConfig.isReadInputsMultiThreaded()) {
+    if (ThisModule->getPrinter()->traceThreads())
+      ThisConfig.raise(Diag::threads_disabled) << "ReadInputs";
+    return true;
+  }
+  eld::RegisterTimer T("Decode ELF Object Files", "Read all Input files",
+                       ThisConfig.options().printTimingStats());
+  std::vector<InputFile *> Objects;
+  for (Node *N : InputVector) {
+    FileNode *Node = llvm::dyn_cast<FileNode>(N);
+    if (!Node)
+      continue;
+    Input *Input = Node->getInput();
+    // Only object files named by path are decoded ahead of time. Resolving
+    // such a path early does not change which file gets picked. Namespecs,
+    // scripts and mapped inputs are left to be resolved in command-line order.
+    if (Input->getInputType() != Input::Default || Input->isAlreadyReleased() ||
+        Input->getAttribute().isBinary() ||
+        ThisConfig.options().hasMappingFile() ||
+        !llvm::sys::fs::is_regular_file(Input->getFileName()))
+      continue;
+    if (!Input->resolvePath(ThisConfig)) {
+      ThisModule->setFailure(true);
+      return false;
+    }
+    if (InputFile *CurInput = getDecodableObjectFile(Input))
+      Objects.push_back(CurInput);
+  }
+  if (ThisModule->getPrinter()->traceThreads())
+    ThisConfig.raise(Diag::threads_enabled)
+        << "ReadInputs" << ThisConfig.options().numThreads();
+  decodeObjectFiles(Objects);
+  return true;
+}
+
+void ObjectLinker::decodeArchiveMembers(const std::vector<Input *> &Members) {
+  if (ThisConfig.options().numThreads() <= 1 ||
+      !ThisConfig.isReadInputsMultiThreaded())
+    return;
+  eld::RegisterTimer T("Decode Archive Members", "Read all Input files",
+                       ThisConfig.options().printTimingStats());
+  std::vector<InputFile *> Objects;
+  for (Input *Member : Members) {
+    if (InputFile *CurInput = getDecodableObjectFile(Member))
+      Objects.push_back(CurInput);
+  }
+  // A single member is cheaper to read in place.
+  if (Objects.size() < 2)
+    return;
+  decodeObjectFiles(Objects);
+}
+
+void ObjectLinker::discardDecodedInput(const Input *I) {
+  if (const InputFile *CurInput = I->getInputFile())
+    RelocObjParser->discardDecodedFile(*CurInput);
+}
+
+InputFile *ObjectLinker::getDecodableObjectFile(Input *Input) {
+  if (Input->isAlreadyReleased() || !Input->getSize())
+    return nullptr;
+  InputFile *CurInput = Input->getInputFile();
+  if (!CurInput) {
+    if (InputFile::getInputFileKind(Input->getFileContents()) !=
+        InputFile::ELFObjFileKind)
+      return nullptr;
+    CurInput = InputFile::create(Input, InputFile::ELFObjFileKind,
+                                 ThisConfig.getDiagEngine());
+    Input->setInputFile(CurInput);
+  }
+  if (CurInput->getKind() != InputFile::ELFObjFileKind ||
+      CurInput->shouldSkipFile())
+    return nullptr;
+  return CurInput;
+}
+
+void ObjectLinker::decodeObjectFiles(const std::vector<InputFile *> &Objects) {
+  // Decoding only reads the input files. Sections and symbols are created, and
+  // symbols are inserted in the NamePool, by readAndProcessInput in link
+  // order.
+  llvm::ThreadPoolInterface *Pool = ThisModule->getThreadPool();
+  for (InputFile *CurInput : Objects)
+    Pool->async([&, CurInput] { RelocObjParser->decodeFile(*CurInput); });
+  Pool->wait();
+}
+
 bool ObjectLinker::readInputs(const std::vector<Node *> &InputVector) {
   typedef std::vector<Node *>::const_iterator Iter;
 
+  if (!decodeInputs(InputVector))
+    return false;
+
   for (Iter Begin = InputVector.begin(), End = InputVector.end(); Begin != End;
        ++Begin) {
     // is a group node
@@ -458,8 +554,10 @@ void ObjectLinker::runGarbageCollection(const std::string &Phase,
                                         bool CommonSectionsOnly) {
   eld::RegisterTimer T("Perform Garbage collection", "Garbage Collection",
                        ThisConfig.options().printTimingStats());
-  GarbageCollection GC(ThisConfig, ThisBackend, *ThisModule);
-  GC.run(Phase, CommonSectionsOnly);
+  if (!MGarbageCollection)
+    MGarbageCollection =
+        make<GarbageCollection>(ThisConfig, ThisBackend, *ThisModule);
+  MGarbageCollection->run(Phase, CommonSectionsOnly);
   MGcHasRun = true;
 }
 
@@ -536,6 +634,7 @@ void ObjectLinker::mergeIdenticalStrings() const {
   /// not be used.
   bool UseThreads = ThisConfig.options().numThreads() > 1;
   bool GlobalMerge = ThisConfig.options().shouldGlobalStringMerge();
+  bool TailMerge = ThisConfig.options().tailMergeStrings();
   llvm::ThreadPoolInterface *Pool = ThisModule->getThreadPool();
   auto MergeStrings = [&](OutputSectionEntry *O) {
     for (RuleContainer *RC : *O) {
@@ -550,6 +649,8 @@ void ObjectLinker::mergeIdenticalStrings() const {
                              F->getOutputELFSection()->getOutputSection());
       }
     }
+    if (TailMerge)
+      Builder.tailMergeStrings(O);
   };
 
   std::vector<OutputSectionEntry *> OutputSections;
@@ -578,7 +679,39 @@ void ObjectLinker::mergeIdenticalStrings() const {
   if (GlobalMerge)
     mergeNonAllocStrings(OutputSections, Builder);
 
+  /// An output section with many strings, such as .debug_str, is merged by all
+  /// the threads. Strings are merged serially when they are traced, so that
+  /// the trace stays in order.
+  bool TraceMergeStrings = ThisModule->getPrinter()->traceMergeStrings() ||
+                           ThisModule->getPrinter()->isVerbose();
+  std::vector<OutputSectionEntry *> SmallOutputSections;
   for (OutputSectionEntry *O : OutputSections) {
+    if (!UseThreads || TraceMergeStrings) {
+      SmallOutputSections.push_back(O);
+      continue;
+    }
+    std::vector<MergeStringFragment *> Fragments;
+    size_t NumStrings = 0;
+    for (RuleContainer *RC : *O) {
+      for (Fragment *F : RC->getSection()->getFragmentList()) {
+        if (!F->isMergeStr())
+          continue;
+        if (GlobalMerge && !F->getOwningSection()->isAlloc())
+          continue;
+        Fragments.push_back(llvm::cast<MergeStringFragment>(F));
+        NumStrings += Fragments.back()->getStrings().size();
+      }
+    }
+    if (NumStrings < MinStringsForParallelMerge)
+      SmallOutputSections.push_back(O);
+    else {
+      Builder.mergeStringsInParallel(Fragments, O);
+      if (TailMerge)
+        Builder.tailMergeStrings(O);
+    }
+  }
+
+  for (OutputSectionEntry *O : SmallOutputSections) {
     if (UseThreads)
       Pool->async(std::bind(MergeStrings, O));
     else
@@ -589,21 +722,56 @@ void ObjectLinker::mergeIdenticalStrings() const {
 }
 
 void ObjectLinker::fixMergeStringRelocations() const {
+  std::vector<ELFObjectFile *> Objects;
   for (InputFile *I : ThisModule->getObjectList()) {
     if (I->isInternal())
       continue;
-    ELFObjectFile *Obj = llvm::dyn_cast<ELFObjectFile>(I);
-    if (!Obj)
-      continue;
-    for (ELFSection *S : Obj->getRelocationSections()) {
-      if (ThisModule->getPrinter()->isVerbose() ||
-          ThisModule->getPrinter()->traceMergeStrings())
-        ThisConfig.raise(Diag::handling_merge_strings_for_section)
-            << S->getDecoratedName(ThisConfig.options())
-            << S->getInputFile()->getInput()->decoratedPath(true);
-      ThisBackend.getRelocator()->doMergeStrings(S);
+    if (ELFObjectFile *Obj = llvm::dyn_cast<ELFObjectFile>(I))
+      Objects.push_back(Obj);
+  }
+
+  // The strings are not modified any more, and the relocations of an object
+  // are only modified by the thread that handles the object. Diagnostics are
+  // collected per object and raised in input order.
+  bool Trace = ThisModule->getPrinter()->isVerbose() ||
+               ThisModule->getPrinter()->traceMergeStrings();
+  std::vector<Relocator::DiagnosticList> Diagnostics(Objects.size());
+  auto FixRelocations = [&](size_t I) {
+    for (ELFSection *S : Objects[I]->getRelocationSections()) {
+      if (Trace)
+        Diagnostics[I].push_back(std::make_unique<plugin::DiagnosticEntry>(
+            Diag::handling_merge_strings_for_section,
+            std::vector<std::string>{
+                S->getDecoratedName(ThisConfig.options()),
+                S->getInputFile()->getInput()->decoratedPath(true)}));
+      ThisBackend.getRelocator()->doMergeStrings(S, &Diagnostics[I]);
     }
+  };
+  auto RaiseDiagnostics = [&](size_t I) {
+    for (auto &Entry : Diagnostics[I])
+      ThisConfig.raiseDiagEntry(std::move(Entry));
+    Diagnostics[I].clear();
+  };
+
+  if (ThisConfig.options().numThreads() <= 1 ||
+      !ThisConfig.isMergeStringsMultiThreaded()) {
+    if (ThisModule->getPrinter()->traceThreads())
+      ThisConfig.raise(Diag::threads_disabled) << "MergeStrings";
+    for (size_t I = 0, E = Objects.size(); I != E; ++I) {
+      FixRelocations(I);
+      RaiseDiagnostics(I);
+    }
+    return;
   }
+  if (ThisModule->getPrinter()->traceThreads())
+    ThisConfig.raise(Diag::threads_enabled)
+        << "MergeStrings" << ThisConfig.options().numThreads();
+  llvm::ThreadPoolInterface *Pool = ThisModule->getThreadPool();
+  for (size_t I = 0, E = Objects.size(); I != E; ++I)
+    Pool->async([&FixRelocations, I] { FixRelocations(I); });
+  Pool->wait();
+  for (size_t I = 0, E = Objects.size(); I != E; ++I)
+    RaiseDiagnostics(I);
 }
 
 void ObjectLinker::doMergeStrings() {
@@ -705,9 +873,49 @@ bool ObjectLinker::mayBeSortSections(std::vector<Section *> &Sections) {
   return true;
 }
 
+bool ObjectLinker::splitEhFrameSections(std::vector<Section *> &Sections) {
+  // Verbose diagnostics are raised while the sections are split, so the
+  // sections are split serially by mergeInputSections to keep them in order.
+  if (ThisConfig.options().numThreads() <= 1 ||
+      !ThisConfig.isEhFrameMultiThreaded() ||
+      ThisModule->getPrinter()->isVerbose()) {
+    if (ThisModule->getPrinter()->traceThreads())
+      ThisConfig.raise(Diag::threads_disabled) << "EhFrame";
+    return true;
+  }
+  std::vector<EhFrameSection *> EhFrames;
+  for (Section *S : Sections) {
+    auto *EhFrame = llvm::dyn_cast<EhFrameSection>(S);
+    if (!EhFrame || EhFrame->isIgnore() || EhFrame->isDiscard() ||
+        EhFrame->getKind() != LDFileFormat::EhFrame)
+      continue;
+    EhFrames.push_back(EhFrame);
+  }
+  if (ThisModule->getPrinter()->traceThreads())
+    ThisConfig.raise(Diag::threads_enabled)
+        << "EhFrame" << ThisConfig.options().numThreads();
+  eld::RegisterTimer T("Split EhFrame Sections", "Merge Sections",
+                       ThisConfig.options().printTimingStats());
+  std::atomic<bool> HasError = false;
+  llvm::ThreadPoolInterface *Pool = ThisModule->getThreadPool();
+  for (EhFrameSection *EhFrame : EhFrames)
+    Pool->async([&HasError, EhFrame] {
+      if (!EhFrame->splitEhFrameSection() ||
+          !EhFrame->createCIEAndFDEFragments())
+        HasError = true;
+    });
+  Pool->wait();
+  for (EhFrameSection *EhFrame : EhFrames)
+    if (EhFrame->hasReadError())
+      EhFrame->raiseReadError();
+  return !HasError;
+}
+
 bool ObjectLinker::mergeInputSections(ObjectBuilder &Builder,
                                       std::vector<Section *> &Sections) {
   bool IsPartialLink = ThisConfig.isLinkPartial();
+  if (!splitEhFrameSections(Sections))
+    return false;
   for (auto &Section : Sections) {
     if (Section->isBitcode())
       continue;
@@ -736,11 +944,13 @@ bool ObjectLinker::mergeInputSections(ObjectBuilder &Builder,
       LLVM_FALLTHROUGH;
     case LDFileFormat::EhFrame: {
       if (Sect->getKind() == LDFileFormat::EhFrame) {
-        if (!llvm::dyn_cast<eld::EhFrameSection>(Sect)->splitEhFrameSection())
-          return false;
-        if (!llvm::dyn_cast<eld::EhFrameSection>(Sect)
-                 ->createCIEAndFDEFragments())
+        auto *EhFrame = llvm::cast<eld::EhFrameSection>(Sect);
+        if (!EhFrame->isSplit() && (!EhFrame->splitEhFrameSection() ||
+                                    !EhFrame->createCIEAndFDEFragments())) {
+          if (EhFrame->hasReadError())
+            EhFrame->raiseReadError();
           return false;
+        }
         llvm::dyn_cast<eld::EhFrameSection>(Sect)->finishAddingFragments(*ThisModule);
         if (ThisBackend.getEhFrameHdr() &&
             Sect->getKind() == LDFileFormat::EhFrame) {
@@ -1968,6 +2178,11 @@ bool ObjectLinker::scanRelocations(bool IsPartialLink) {
     }
     Pool->wait();
   }
+  // GOT, PLT and relative relocation bookkeeping is recorded per file while
+  // scanning, merge it in input order.
+  for (auto &Input : ThisModule->getObjectList())
+    if (ELFObjectFile *Obj = llvm::dyn_cast<ELFObjectFile>(Input))
+      ThisBackend.mergeScannedEntries(*Obj);
   // assume there is only one copy relocation type per target
   Relocation::Type CopyRelocType = ThisBackend.getCopyRelType();
   for (const auto &RelocVec : AllCopyRelocs)
@@ -2123,6 +2338,82 @@ void ObjectLinker::finalizeSymbolValue(ResolveInfo *I) const {
   }
 }
 
+bool ObjectLinker::shouldApplyRelocation(Relocation *R) {
+  // bypass the reloc if the symbol is in the discarded input section
+  ResolveInfo *Info = R->symInfo();
+
+  // Dont process relocations that are relaxed.
+  if (ThisBackend.isRelocationRelaxed(R))
+    return false;
+
+  if (!Info->outSymbol()->hasFragRef() &&
+      ResolveInfo::Section == Info->type() &&
+      ResolveInfo::Undefined == Info->desc())
+    return false;
+
+  if ((Info->outSymbol()->hasFragRef() &&
+       Info->outSymbol()->fragRef()->frag()->getOwningSection()->isDiscard()))
+    return false;
+
+  ELFSection *ApplySect = R->targetRef()->frag()->getOwningSection();
+  // bypass the reloc if the section where it sits will be discarded.
+  if (ApplySect->isIgnore())
+    return false;
+  if (ApplySect->isDiscard())
+    return false;
+  ELFSection *TargetSect = R->targetSection();
+  if (Info->outSymbol()->shouldIgnore() ||
+      (Info->outSymbol()->fragRef() &&
+       Info->outSymbol()->fragRef()->isDiscard()) ||
+      (TargetSect && TargetSect->isIgnore())) {
+    if (ThisModule->getPrinter()->isVerbose())
+      ThisConfig.raise(Diag::applying_endof_image_address)
+          << Info->name() << R->getTargetPath(ThisConfig.options())
+          << R->getSourcePath(ThisConfig.options());
+    R->target() = ThisBackend.getValueForDiscardedRelocations(R);
+    return false;
+  }
+  return true;
+}
+
+void ObjectLinker::applyRelocationForUse(Relocation *R) {
+  // Before relocation() has run, or without --apply-relocations-in-place,
+  // relocation() applies the relocation.
+  if (!ApplyRelocationsInPlace)
+    return;
+  if (!ThisModule->markRelocationApplied(R))
+    return;
+  if (shouldApplyRelocation(R))
+    R->apply(*ThisBackend.getRelocator());
+}
+
+bool ObjectLinker::shouldSyncRelocation(const Relocation *R) const {
+  // bypass the reloc if the symbol is in the discarded input section
+  ResolveInfo *Info = R->symInfo();
+
+  if (!Info->outSymbol()->hasFragRef() &&
+      ResolveInfo::Section == Info->type() &&
+      ResolveInfo::Undefined == Info->desc())
+    return false;
+
+  if (R->targetRef()->frag()->getOwningSection()->isIgnore())
+    return false;
+
+  if (R->targetRef()->frag()->getOwningSection()->isDiscard())
+    return false;
+
+  // bypass the relocation with NONE type. This is to avoid overwrite
+  // the target result by NONE type relocation if there is a place which
+  // has two relocations to apply to, and one of it is NONE type. The
+  // result we want is the value of the other relocation result. For
+  // example, in .exidx, there are usually an R_ARM_NONE and
+  // R_ARM_PREL31 apply to the same place
+  if (0x0 == R->type())
+    return false;
+
+  return true;
+}
+
 /// relocate - applying relocation entries and create relocation
 /// section in the output files
 /// Create relocation section, asking GNULDBackend to
@@ -2133,6 +2424,20 @@ bool ObjectLinker::relocation(bool EmitRelocs) {
   if (LinkerConfig::Object == ThisConfig.codeGenType())
     return true;
 
+  // With --apply-relocations-in-place, relocations are applied while the
+  // output file is written, see syncRelocations. Relocations that plugins
+  // have inspected so far are still applied here; which ones is decided now,
+  // so that later reads cannot keep a relocation from being applied.
+  // Emitting relocations needs every relocation to be visited before the
+  // output is laid out, so it always uses this path.
+  ApplyRelocationsInPlace =
+      ThisConfig.options().applyRelocationsInPlace() && !EmitRelocs;
+  if (ApplyRelocationsInPlace)
+    ThisModule->recordInspectedRelocationsAsApplied();
+  auto ApplyNow = [&](const Relocation *R) {
+    return !ApplyRelocationsInPlace || ThisModule->isRelocationApplied(R);
+  };
+
   // Mapping section to count and max_size.
   llvm::DenseMap<ELFSection *, unsigned> RelocCount, MaxSectSize;
 
@@ -2177,6 +2482,8 @@ bool ObjectLinker::relocation(bool EmitRelocs) {
   };
 
   auto ProcessObjectFile = [&](ObjectFile *ObjFile) -> bool {
+    if (ApplyRelocationsInPlace && !ThisModule->hasAppliedRelocations())
+      return true;
     for (auto &Sect : ObjFile->getSections()) {
       if (Sect->isBitcode())
         continue;
@@ -2189,7 +2496,8 @@ bool ObjectLinker::relocation(bool EmitRelocs) {
       if (Section->isRelocationSection())
         continue;
       for (auto &Relocation : Section->getRelocations()) {
-        Relocation->apply(*ThisBackend.getRelocator());
+        if (ApplyNow(Relocation))
+          Relocation->apply(*ThisBackend.getRelocator());
       }
     }
 
@@ -2207,51 +2515,11 @@ bool ObjectLinker::relocation(bool EmitRelocs) {
         continue;
       if (Rs->isDiscard())
         continue;
-      auto ProcessReloc = [&](Relocation *Relocation) -> bool {
-        // bypass the reloc if the symbol is in the discarded input section
-        ResolveInfo *Info = Relocation->symInfo();
-
-        // Dont process relocations that are relaxed.
-        if (ThisBackend.isRelocationRelaxed(Relocation))
-          return false;
-
-        if (!Info->outSymbol()->hasFragRef() &&
-            ResolveInfo::Section == Info->type() &&
-            ResolveInfo::Undefined == Info->desc())
-          return false;
-
-        if ((Info->outSymbol()->hasFragRef() && Info->outSymbol()
-                                                    ->fragRef()
-                                                    ->frag()
-                                                    ->getOwningSection()
-                                                    ->isDiscard()))
-          return false;
-
-        ELFSection *ApplySect =
-            Relocation->targetRef()->frag()->getOwningSection();
-        // bypass the reloc if the section where it sits will be discarded.
-        if (ApplySect->isIgnore())
-          return false;
-        if (ApplySect->isDiscard())
-          return false;
-        ELFSection *TargetSect = Relocation->targetSection();
-        if (Info->outSymbol()->shouldIgnore() ||
-            (Info->outSymbol()->fragRef() &&
-             Info->outSymbol()->fragRef()->isDiscard()) ||
-            (TargetSect && TargetSect->isIgnore())) {
-          if (ThisModule->getPrinter()->isVerbose())
-            ThisConfig.raise(Diag::applying_endof_image_address)
-                << Info->name()
-                << Relocation->getTargetPath(ThisConfig.options())
-                << Relocation->getSourcePath(ThisConfig.options());
-          Relocation->target() =
-              ThisBackend.getValueForDiscardedRelocations(Relocation);
-          return false;
-        }
-        return true;
-      };
       for (auto &Relocation : Rs->getLink()->getRelocations()) {
-        if (ProcessReloc(Relocation)) {
+        // Relocations applied in place are handled by syncRelocations.
+        if (!ApplyNow(Relocation))
+          continue;
+        if (shouldApplyRelocation(Relocation)) {
           if (EmitRelocs)
             EmitOneReloc(Relocation);
           Relocation->apply(*ThisBackend.getRelocator());
@@ -2308,14 +2576,16 @@ bool ObjectLinker::relocation(bool EmitRelocs) {
     for (; Bi != Be; ++Bi) {
       BranchIsland::reloc_iterator Iter, IterEnd = (*Bi)->relocEnd();
       for (Iter = (*Bi)->relocBegin(); Iter != IterEnd; ++Iter) {
-        (*Iter)->apply(*ThisBackend.getRelocator());
+        if (ApplyNow(*Iter))
+          (*Iter)->apply(*ThisBackend.getRelocator());
       }
     }
   }
 
   // apply linker created relocations
   for (auto *R : ThisBackend.getInternalRelocs()) {
-    R->apply(*ThisBackend.getRelocator());
+    if (ApplyNow(R))
+      R->apply(*ThisBackend.getRelocator());
   }
 
   // apply relocations
@@ -2339,6 +2609,10 @@ ObjectLinker::postProcessing(llvm::FileOutputBuffer &POutput) {
     syncRelocations(POutput.getBufferStart());
   }
 
+  // Errors from relocations applied in place are reported by the caller.
+  if (ApplyRelocationsInPlace && !ThisConfig.getDiagEngine()->diagnose())
+    return {};
+
   {
     eld::RegisterTimer T("Post Process Output File", "Emit Output File",
                          ThisConfig.options().printTimingStats());
@@ -2349,6 +2623,12 @@ ObjectLinker::postProcessing(llvm::FileOutputBuffer &POutput) {
 }
 
 void ObjectLinker::syncRelocations(uint8_t *Buffer) {
+  // With --apply-relocations-in-place, each relocation is applied right
+  // before its result is written, so relocations are visited only once.
+  auto ApplyInPlace = [&](Relocation *R) -> void {
+    if (ApplyRelocationsInPlace && !ThisModule->isRelocationApplied(R))
+      R->apply(*ThisBackend.getRelocator());
+  };
 
   // We MUST write relocation by relaxation before those
   // from the inputs because something like R_AARCH64_COPY_INSN
@@ -2360,19 +2640,24 @@ void ObjectLinker::syncRelocations(uint8_t *Buffer) {
     branch_island_iter Be = O->islandsEnd();
     for (; Bi != Be; ++Bi) {
       BranchIsland::reloc_iterator Iter, IterEnd = (*Bi)->relocEnd();
-      for (Iter = (*Bi)->relocBegin(); Iter != IterEnd; ++Iter)
+      for (Iter = (*Bi)->relocBegin(); Iter != IterEnd; ++Iter) {
+        ApplyInPlace(*Iter);
         writeRelocationResult(**Iter, Buffer);
+      }
     }
   };
   // sync relocations created by relaxation
   if (ThisConfig.options().numThreads() <= 1 ||
-      !ThisConfig.isSyncRelocationsMultiThreaded()) {
+      !ThisConfig.isSyncRelocationsMultiThreaded() ||
+      (ApplyRelocationsInPlace &&
+       !ThisConfig.isApplyRelocationsMultiThreaded())) {
     if (ThisModule->getPrinter()->traceThreads())
       ThisConfig.raise(Diag::threads_disabled) << "SyncRelocations";
     for (auto &Out : ThisModule->getScript().sectionMap())
       SyncBranchIslandsForOutputSection(Out);
     // sync linker created internal relocations
     for (auto *R : ThisBackend.getInternalRelocs()) {
+      ApplyInPlace(R);
       writeRelocationResult(*R, Buffer);
     }
     for (auto &Input : ThisModule->getObjectList()) {
@@ -2396,7 +2681,10 @@ void ObjectLinker::syncRelocations(uint8_t *Buffer) {
     Pool->wait();
     // sync linker created internal relocations
     for (auto &R : ThisBackend.getInternalRelocs()) {
-      Pool->async([this, &R, &Buffer] { writeRelocationResult(*R, Buffer); });
+      Pool->async([&ApplyInPlace, this, &R, &Buffer] {
+        ApplyInPlace(R);
+        writeRelocationResult(*R, Buffer);
+      });
     }
     Pool->wait();
     for (auto &Input : ThisModule->getObjectList()) {
@@ -2423,6 +2711,9 @@ void ObjectLinker::syncRelocationResult(uint8_t *Data, InputFile *Input) {
     if (Section->isRelocationSection())
       continue;
     for (auto &Relocation : Section->getRelocations()) {
+      if (ApplyRelocationsInPlace &&
+          !ThisModule->isRelocationApplied(Relocation))
+        Relocation->apply(*ThisBackend.getRelocator());
       writeRelocationResult(*Relocation, Data);
     }
   }
@@ -2436,37 +2727,16 @@ void ObjectLinker::syncRelocationResult(uint8_t *Data, InputFile *Input) {
       continue;
 
     for (auto &Relocation : Rs->getLink()->getRelocations()) {
-
-      auto SyncOneReloc = [&](class Relocation *Relocation) -> bool {
-        // bypass the reloc if the symbol is in the discarded input section
-        ResolveInfo *Info = Relocation->symInfo();
-
-        if (!Info->outSymbol()->hasFragRef() &&
-            ResolveInfo::Section == Info->type() &&
-            ResolveInfo::Undefined == Info->desc())
-          return false;
-
-        if (Relocation->targetRef()->frag()->getOwningSection()->isIgnore())
-          return false;
-
-        if (Relocation->targetRef()->frag()->getOwningSection()->isDiscard())
-          return false;
-
-        // bypass the relocation with NONE type. This is to avoid overwrite
-        // the target result by NONE type relocation if there is a place which
-        // has two relocations to apply to, and one of it is NONE type. The
-        // result we want is the value of the other relocation result. For
-        // example, in .exidx, there are usually an R_ARM_NONE and
-        // R_ARM_PREL31 apply to the same place
-        if (0x0 == Relocation->type())
-          return false;
-
-        return true;
-      };
+      // Relocations inspected by plugins were already applied, either by
+      // relocation() or on first use.
+      if (ApplyRelocationsInPlace &&
+          !ThisModule->isRelocationApplied(Relocation) &&
+          shouldApplyRelocation(Relocation))
+        Relocation->apply(*ThisBackend.getRelocator());
       uint64_t ModifiedRelocData = 0;
       if (ThisModule->getRelocationDataForSync(Relocation, ModifiedRelocData))
         writeRelocationData(*Relocation, ModifiedRelocData, Data);
-      else if (SyncOneReloc(Relocation))
+      else if (shouldSyncRelocation(Relocation))
         writeRelocationResult(*Relocation, Data);
     } // for all relocations
   } // for all relocation section
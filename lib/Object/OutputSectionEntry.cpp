@@ -5,6 +5,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "eld/Object/OutputSectionEntry.h"
+#include "eld/BranchIsland/BranchIsland.h"
 #include "eld/Core/Module.h"
 #include "eld/Fragment/RegionFragmentEx.h"
 #include "eld/Readers/ELFSection.h"
@@ -87,6 +88,27 @@ uint64_t OutputSectionEntry::getTotalTrampolineCount() const {
   return Count;
 }
 
+void OutputSectionEntry::addBranchIsland(Module &M, ResolveInfo *PSym,
+                                         BranchIsland *B) {
+  std::vector<BranchIsland *> &Islands = BranchIslandForSymbol[PSym];
+  int64_t Addr = B->branchIslandAddr(M);
+  auto Pos = std::upper_bound(Islands.begin(), Islands.end(), Addr,
+                              [&M](int64_t A, BranchIsland *I) {
+                                return A < I->branchIslandAddr(M);
+                              });
+  Islands.insert(Pos, B);
+  MBranchIslands.push_back(B);
+}
+
+const std::vector<BranchIsland *> &
+OutputSectionEntry::getBranchIslandsForSymbol(ResolveInfo *PSym) const {
+  static const std::vector<BranchIsland *> NoIslands;
+  auto Iter = BranchIslandForSymbol.find(PSym);
+  if (Iter == BranchIslandForSymbol.end())
+    return NoIslands;
+  return Iter->second;
+}
+
 Fragment *OutputSectionEntry::getFirstFrag() const {
   if (!FirstNonEmptyRule ||
       !FirstNonEmptyRule->getSection()->getFragmentList().size())
@@ -0,0 +1,157 @@
+//===- RuleMatchCache.cpp--------------------------------------------------===//
+// Part of the eld Project, under the BSD License
+// See https://github.com/qualcomm/eld/LICENSE.txt for license information.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+#include "eld/Object/RuleMatchCache.h"
+#include "eld/Config/LinkerConfig.h"
+#include "eld/Core/LinkerScript.h"
+#include "eld/Core/Module.h"
+#include "eld/Input/Input.h"
+#include "eld/Input/InputFile.h"
+#include "eld/Object/OutputSectionEntry.h"
+#include "eld/Object/RuleContainer.h"
+#include "eld/Object/RuleMatcher.h"
+#include "eld/Object/SectionMap.h"
+#include "eld/Script/StringList.h"
+#include "eld/Script/WildcardPattern.h"
+#include "eld/Support/MsgHandling.h"
+#include "llvm/ADT/SmallString.h"
+#include "llvm/ADT/StringExtras.h"
+#include "llvm/Support/Endian.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/Path.h"
+#include "llvm/Support/raw_ostream.h"
+#include "llvm/Support/xxhash.h"
+
+using namespace eld;
+using namespace llvm;
+
+namespace {
+// Bump the version whenever the format or the key computation changes.
+constexpr StringRef CacheMagic = "ELDRMC02";
+constexpr size_t HeaderSize = 8 + 8 + 4 + 4;
+constexpr size_t EntrySize = 8 + 4 + 4;
+} // namespace
+
+RuleMatchCache::RuleMatchCache(Module &M, StringRef CacheDir)
+    : Dir(CacheDir.str()) {
+  const LinkerConfig &Config = M.getConfig();
+  const RuleMatcher &Matcher = M.getScript().sectionMap().getRuleMatcher();
+  std::string Str;
+  raw_string_ostream OS(Str);
+  OS << CacheMagic << '\0'
+     << (Config.options().getScriptOption() == GeneralOptions::MatchGNU)
+     << (Config.codeGenType() == LinkerConfig::Object)
+     << M.getScript().linkerScriptHasSectionsCommand()
+     << Config.options().isThinArchiveRuleMatchingCompatibilityEnabled()
+     << '\0';
+  for (size_t I = 0, E = Matcher.size(); I != E; ++I) {
+    const OutputSectionEntry *Out = Matcher.getRule(I).first;
+    const RuleContainer *In = Matcher.getRule(I).second;
+    OS << Out->name() << '\0' << Out->prolog().constraint() << '\0'
+       << Out->isDiscard() << '\0' << In->policy() << '\0'
+       << In->getAsString() << '\0';
+    if (In->spec().hasFile())
+      OS << In->spec().file().name() << '\0';
+    if (In->spec().isArchive() && In->spec().hasArchiveMember())
+      OS << In->spec().archiveMember().name() << '\0';
+    for (const StrToken *S : In->spec().sections())
+      OS << S->name() << '\0';
+    OS << '\n';
+  }
+  RulesHash = xxh3_64bits(OS.str());
+}
+
+bool RuleMatchCache::init(const LinkerConfig &Config) {
+  if (std::error_code EC = sys::fs::create_directories(Dir)) {
+    Config.raise(Diag::warn_rule_matching_cache_dir) << Dir << EC.message();
+    return false;
+  }
+  return true;
+}
+
+uint64_t RuleMatchCache::getNameHash(StringRef Name) {
+  return xxh3_64bits(Name);
+}
+
+uint64_t RuleMatchCache::getKey(const InputFile &I) const {
+  std::string Str;
+  raw_string_ostream OS(Str);
+  OS << RulesHash << '\0' << xxh3_64bits(I.getContents()) << '\0'
+     << I.getInput()->getResolvedPath().native() << '\0'
+     << I.getInput()->getName();
+  return xxh3_64bits(OS.str());
+}
+
+std::string RuleMatchCache::getPath(uint64_t Key) const {
+  SmallString<256> Path(Dir);
+  sys::path::append(Path, utohexstr(Key, /*LowerCase=*/true) + ".rmc");
+  return std::string(Path);
+}
+
+std::optional<std::vector<RuleMatchCache::Entry>>
+RuleMatchCache::read(uint64_t Key) const {
+  auto Buffer = MemoryBuffer::getFile(getPath(Key), /*IsText=*/false,
+                                      /*RequiresNullTerminator=*/false);
+  if (!Buffer)
+    return std::nullopt;
+  StringRef Data = (*Buffer)->getBuffer();
+  if (Data.size() < HeaderSize || !Data.starts_with(CacheMagic))
+    return std::nullopt;
+  const char *P = Data.data() + CacheMagic.size();
+  if (support::endian::read64le(P) != RulesHash)
+    return std::nullopt;
+  uint32_t NumEntries = support::endian::read32le(P + 8);
+  if (Data.size() != HeaderSize + NumEntries * EntrySize)
+    return std::nullopt;
+  std::vector<Entry> Entries(NumEntries);
+  P = Data.data() + HeaderSize;
+  for (Entry &E : Entries) {
+    E.NameHash = support::endian::read64le(P);
+    E.RuleIdx = support::endian::read32le(P + 8);
+    E.Flags = support::endian::read32le(P + 12);
+    P += EntrySize;
+  }
+  return Entries;
+}
+
+bool RuleMatchCache::write(uint64_t Key, ArrayRef<Entry> Entries) const {
+  std::string Data;
+  Data.reserve(HeaderSize + Entries.size() * EntrySize);
+  raw_string_ostream OS(Data);
+  support::endian::Writer W(OS, llvm::endianness::little);
+  OS << CacheMagic;
+  W.write<uint64_t>(RulesHash);
+  W.write<uint32_t>(Entries.size());
+  W.write<uint32_t>(0);
+  for (const Entry &E : Entries) {
+    W.write<uint64_t>(E.NameHash);
+    W.write<uint32_t>(E.RuleIdx);
+    W.write<uint32_t>(E.Flags);
+  }
+  OS.flush();
+
+  SmallString<256> TempPath;
+  int FD;
+  SmallString<256> Model(Dir);
+  sys::path::append(Model, "rmc-%%%%%%%%.tmp");
+  if (sys::fs::createUniqueFile(Model, FD, TempPath))
+    return false;
+  {
+    raw_fd_ostream File(FD, /*shouldClose=*/true);
+    File << Data;
+    File.close();
+    if (File.has_error()) {
+      File.clear_error();
+      sys::fs::remove(TempPath);
+      return false;
+    }
+  }
+  if (sys::fs::rename(TempPath, getPath(Key))) {
+    sys::fs::remove(TempPath);
+    return false;
+  }
+  return true;
+}
@@ -0,0 +1,143 @@
+//===- RuleMatcher.cpp-----------------------------------------------------===//
+// Part of the eld Project, under the BSD License
+// See https://github.com/qualcomm/eld/LICENSE.txt for license information.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+#include "eld/Object/RuleMatcher.h"
+#include "eld/Object/OutputSectionEntry.h"
+#include "eld/Object/RuleContainer.h"
+#include "eld/Object/SectionMap.h"
+#include "eld/Script/StringList.h"
+#include "eld/Script/WildcardPattern.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/StringSwitch.h"
+#include "llvm/Support/Casting.h"
+
+using namespace eld;
+using namespace llvm;
+
+namespace {
+// Characters that make a pattern a glob pattern. Braces are included because
+// GlobPattern expands brace expressions.
+constexpr const char *GlobChars = "*?[]{}\\";
+
+bool hasGlobChars(StringRef S) {
+  return S.find_first_of(GlobChars) != StringRef::npos;
+}
+
+// COMMON and .scommon.x patterns are expanded to COMMON.* and .scommon.x.*
+// when matching internal common sections, see
+// SectionMap::getWithSyntacticSugarForCommonPattern. Such patterns are always
+// considered by the matcher.
+bool isCommonPattern(StringRef S) {
+  return StringSwitch<bool>(S)
+      .Cases("COMMON", ".scommon.1", ".scommon.2", ".scommon.4", ".scommon.8",
+             true)
+      .Default(false);
+}
+} // namespace
+
+void RuleMatcher::build(SectionMap &SM) {
+  Rules.clear();
+  RuleIndices.clear();
+  ExactRules.clear();
+  PrefixTrie.assign(1, TrieNode());
+  SuffixTrie.assign(1, TrieNode());
+  GlobRules.clear();
+  NumExactPatterns = NumPrefixPatterns = NumSuffixPatterns = NumGlobPatterns =
+      0;
+  NumRuleChecks = 0;
+
+  for (OutputSectionEntry *Out : SM) {
+    for (RuleContainer *In : *Out) {
+      // A rule without section patterns never matches an input section.
+      if (!In->spec().hasSections())
+        continue;
+      uint32_t RuleIdx = Rules.size();
+      Rules.push_back(std::make_pair(Out, In));
+      RuleIndices[In] = RuleIdx;
+      for (const StrToken *S : In->spec().sections()) {
+        const WildcardPattern &Pattern = llvm::cast<WildcardPattern>(*S);
+        StringRef Name = Pattern.name();
+        if (isCommonPattern(Name)) {
+          GlobRules.push_back(RuleIdx);
+          ++NumGlobPatterns;
+        } else if (Pattern.hasHash()) {
+          ExactRules[Pattern.hashValue()].push_back(RuleIdx);
+          ++NumExactPatterns;
+        } else if (Name.size() > 1 && Name.back() == '*' &&
+                   !hasGlobChars(Name.drop_back())) {
+          insert(PrefixTrie, Name.drop_back(), /*Reverse=*/false, RuleIdx);
+          ++NumPrefixPatterns;
+        } else if (Name.size() > 1 && Name.front() == '*' &&
+                   !hasGlobChars(Name.drop_front())) {
+          insert(SuffixTrie, Name.drop_front(), /*Reverse=*/true, RuleIdx);
+          ++NumSuffixPatterns;
+        } else {
+          GlobRules.push_back(RuleIdx);
+          ++NumGlobPatterns;
+        }
+      }
+    }
+  }
+  GlobRules.erase(std::unique(GlobRules.begin(), GlobRules.end()),
+                  GlobRules.end());
+}
+
+uint32_t RuleMatcher::findChild(const TrieNode &Node, char C) {
+  for (const auto &Child : Node.Children)
+    if (Child.first == C)
+      return Child.second;
+  // The root is never a child, so zero denotes a missing child.
+  return 0;
+}
+
+void RuleMatcher::insert(std::vector<TrieNode> &Trie, StringRef Key,
+                         bool Reverse, uint32_t RuleIdx) {
+  uint32_t Node = 0;
+  for (size_t I = 0, E = Key.size(); I != E; ++I) {
+    char C = Reverse ? Key[E - I - 1] : Key[I];
+    if (uint32_t Child = findChild(Trie[Node], C)) {
+      Node = Child;
+      continue;
+    }
+    uint32_t Child = Trie.size();
+    Trie.emplace_back();
+    Trie[Node].Children.push_back(std::make_pair(C, Child));
+    Node = Child;
+  }
+  if (Trie[Node].Rules.empty() || Trie[Node].Rules.back() != RuleIdx)
+    Trie[Node].Rules.push_back(RuleIdx);
+}
+
+void RuleMatcher::lookup(const std::vector<TrieNode> &Trie, StringRef Name,
+                         bool Reverse, CandidateList &Candidates) {
+  if (Trie.empty())
+    return;
+  uint32_t Node = 0;
+  for (size_t I = 0, E = Name.size(); I != E; ++I) {
+    char C = Reverse ? Name[E - I - 1] : Name[I];
+    Node = findChild(Trie[Node], C);
+    if (!Node)
+      return;
+    Candidates.append(Trie[Node].Rules.begin(), Trie[Node].Rules.end());
+  }
+}
+
+void RuleMatcher::getCandidates(StringRef Name, uint64_t NameHash,
+                                CandidateList &Candidates) const {
+  Candidates.clear();
+  Candidates.append(GlobRules.begin(), GlobRules.end());
+  auto Exact = ExactRules.find(NameHash);
+  if (Exact != ExactRules.end())
+    Candidates.append(Exact->second.begin(), Exact->second.end());
+  if (!Name.empty()) {
+    lookup(PrefixTrie, Name, /*Reverse=*/false, Candidates);
+    lookup(SuffixTrie, Name, /*Reverse=*/true, Candidates);
+  }
+  // Restore the linker script order; a rule may be reached through several of
+  // its patterns.
+  llvm::sort(Candidates);
+  Candidates.erase(std::unique(Candidates.begin(), Candidates.end()),
+                   Candidates.end());
+}
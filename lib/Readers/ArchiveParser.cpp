@@ -16,8 +16,10 @@
 #include "eld/PluginAPI/Expected.h"
 #include "eld/Support/MemoryArea.h"
 #include "eld/Support/RegisterTimer.h"
+#include "eld/SymbolResolver/NamePool.h"
 #include "eld/Target/GNULDBackend.h"
 #include "llvm-c/Core.h"
+#include "llvm/ADT/DenseSet.h"
 #include "llvm/ADT/Hashing.h"
 #include "llvm/ADT/STLExtras.h"
 #include "llvm/BinaryFormat/ELF.h"
@@ -100,41 +102,111 @@ eld::Expected<uint32_t> ArchiveParser::parseFile(InputFile &inputFile) const {
   }
 
   // include the needed members in the archive and build up the input tree
-  bool willSymResolved = false;
-  InputFile *referredSite = nullptr;
-  LayoutInfo *layoutInfo = m_Module.getLayoutInfo();
   config.raise(Diag::verbose_performing_archive_symbol_resolution)
       << inputFile.getInput()->decoratedPath();
+  addLazySymbols(*archiveFile);
+  resolveLazySymbols(*archiveFile);
+  return 0;
+}
+
+void ArchiveParser::addLazySymbols(ArchiveFile &archiveFile) const {
+  bool isPostLTOPhase = m_Module.isPostLTOPhase();
+  bool isAdded = archiveFile.hasLazySymbols();
+  if (isAdded && archiveFile.isLazySymbolsPostLTO() == isPostLTOPhase)
+    return;
+  archiveFile.setHasLazySymbols(isPostLTOPhase);
+  NamePool &namePool = m_Module.getNamePool();
+  ArchiveFile::SymTabType &symTab = archiveFile.getSymbolTable();
+  for (size_t idx = 0; idx < symTab.size(); ++idx) {
+    if (ArchiveFile::Symbol::Unknown != archiveFile.getSymbolStatus(idx))
+      continue;
+    // The symbols are already known to the NamePool, but the resolution
+    // rules differ after LTO, so all of them need to be looked at again.
+    if (isAdded) {
+      archiveFile.addPendingSymbol(idx);
+      continue;
+    }
+    namePool.addLazySymbol(symTab[idx]->Name, &archiveFile, idx);
+  }
+}
+
+uint32_t ArchiveParser::resolveLazySymbols(ArchiveFile &archiveFile) const {
+  InputFile *referredSite = nullptr;
+  LayoutInfo *layoutInfo = m_Module.getLayoutInfo();
+  // Pending symbols are visited in symbol table order. Including a member may
+  // mark more symbols as pending: the ones after the current symbol are
+  // visited in the same sweep, and the ones before it in the next sweep. This
+  // is the same order in which a full scan of the symbol table would include
+  // the members.
+  std::set<uint32_t> &pending = archiveFile.getPendingSymbols();
+  ObjectLinker &objLinker = *m_Module.getLinker()->getObjectLinker();
+  uint32_t numIncluded = 0;
+  bool willSymResolved = false;
   do {
     willSymResolved = false;
-
-    for (size_t idx = 0; idx < archiveFile->numOfSymbols(); ++idx) {
+    std::vector<Input *> selected = getSelectedMembers(archiveFile);
+    objLinker.decodeArchiveMembers(selected);
+    llvm::DenseSet<const Input *> included;
+    auto it = pending.begin();
+    while (it != pending.end()) {
+      uint32_t idx = *it;
+      pending.erase(it);
+      it = pending.upper_bound(idx);
       // bypass if we already decided to include this symbol or not
-      if (ArchiveFile::Symbol::Unknown != archiveFile->getSymbolStatus(idx))
+      if (ArchiveFile::Symbol::Unknown != archiveFile.getSymbolStatus(idx))
         continue;
 
       // check if we should include this defined symbol
-      ArchiveFile::Symbol &symbol = *(archiveFile->getSymbolTable()[idx]);
+      ArchiveFile::Symbol &symbol = *(archiveFile.getSymbolTable()[idx]);
       ArchiveFile::Symbol::SymbolStatus status =
           shouldIncludeSymbol(symbol, &referredSite);
-      if (ArchiveFile::Symbol::Include == status) {
-        // include the object member from the given offset
-        Input *I =
-            archiveFile->getLazyLoadMember(archiveFile->getObjFileOffset(idx));
-        if (!includeMember(I))
-          continue;
-        archiveFile->setSymbolStatus(idx, status);
-        willSymResolved = true;
-        if (layoutInfo && referredSite)
-          layoutInfo->recordArchiveMember(
-              I, referredSite, &symbol,
-              llvm::cast<eld::ObjectFile>(I->getInputFile())
-                  ->getSymbol(symbol.Name));
-      } // end of if
-    } // end of for
-  } while (willSymResolved);
-
-  return willSymResolved;
+      if (ArchiveFile::Symbol::Include != status)
+        continue;
+      // include the object member from the given offset
+      Input *I =
+          archiveFile.getLazyLoadMember(archiveFile.getObjFileOffset(idx));
+      if (!includeMember(I))
+        continue;
+      archiveFile.setSymbolStatus(idx, status);
+      willSymResolved = true;
+      included.insert(I);
+      ++numIncluded;
+      if (layoutInfo && referredSite)
+        layoutInfo->recordArchiveMember(
+            I, referredSite, &symbol,
+            llvm::cast<eld::ObjectFile>(I->getInputFile())
+                ->getSymbol(symbol.Name));
+      // Including the member may have added pending symbols after idx.
+      it = pending.upper_bound(idx);
+    }
+    // Selection is speculative, drop members that were not included after
+    // all.
+    for (Input *I : selected) {
+      if (!included.count(I))
+        objLinker.discardDecodedInput(I);
+    }
+  } while (willSymResolved && !pending.empty());
+
+  return numIncluded;
+}
+
+std::vector<Input *>
+ArchiveParser::getSelectedMembers(ArchiveFile &archiveFile) const {
+  std::vector<Input *> selected;
+  llvm::DenseSet<Input *> seen;
+  InputFile *referredSite = nullptr;
+  for (uint32_t idx : archiveFile.getPendingSymbols()) {
+    if (ArchiveFile::Symbol::Unknown != archiveFile.getSymbolStatus(idx))
+      continue;
+    const ArchiveFile::Symbol &symbol = *(archiveFile.getSymbolTable()[idx]);
+    if (ArchiveFile::Symbol::Include !=
+        shouldIncludeSymbol(symbol, &referredSite))
+      continue;
+    Input *I = archiveFile.getLazyLoadMember(archiveFile.getObjFileOffset(idx));
+    if (I && seen.insert(I).second)
+      selected.push_back(I);
+  }
+  return selected;
 }
 
 eld::Expected<bool>
@@ -9,6 +9,7 @@
 #include "eld/Config/LinkerConfig.h"
 #include "eld/Core/Module.h"
 #include "eld/Diagnostics/DiagnosticEngine.h"
+#include "eld/Fragment/MergeConstantFragment.h"
 #include "eld/Input/ELFFileBase.h"
 #include "eld/Input/ELFObjectFile.h"
 #include "eld/Input/InputFile.h"
@@ -21,6 +22,7 @@
 #include "eld/Target/GNULDBackend.h"
 #include "eld/Target/LDFileFormat.h"
 #include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/StringExtras.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/ADT/StringSet.h"
 #include "llvm/Object/ELF.h"
@@ -67,11 +69,11 @@ ELFReader<ELFT>::getSectionName(Elf_Shdr rawSectHdr) {
 template <class ELFT>
 LDFileFormat::Kind
 ELFReader<ELFT>::getSectionKind(Elf_Shdr rawSectHdr,
-                                llvm::StringRef sectionName) {
+                                llvm::StringRef sectionName, bool diagnose) {
   LinkerConfig &config = m_Module.getConfig();
   LDFileFormat::Kind kind = LDFileFormat::getELFSectionKind(
       rawSectHdr.sh_flags, rawSectHdr.sh_addralign, rawSectHdr.sh_entsize,
-      rawSectHdr.sh_type, sectionName, config);
+      rawSectHdr.sh_type, sectionName, config, diagnose);
   return kind;
 }
 
@@ -355,17 +357,130 @@ template <class ELFT> eld::Expected<bool> ELFReader<ELFT>::readSymbols() {
     }
   }
 
+  bool hasDecodedNames = m_DecodedSymNames.size() == elfSyms.size();
   for (size_t idx = 1; idx < elfSyms.size(); ++idx) {
     const Elf_Sym &rawSym = elfSyms[idx];
-    llvm::Expected<llvm::StringRef> expLdName = rawSym.getName(strTab);
-    LLVMEXP_RETURN_DIAGENTRY_IF_ERROR(expLdName);
-    eld::Expected<LDSymbol *> expSym = createSymbol(
-        strTab, rawSym, idx, PatchableSymbols.contains(*expLdName));
+    llvm::StringRef ldName;
+    if (hasDecodedNames) {
+      ldName = m_DecodedSymNames[idx];
+    } else {
+      llvm::Expected<llvm::StringRef> expLdName = rawSym.getName(strTab);
+      LLVMEXP_RETURN_DIAGENTRY_IF_ERROR(expLdName);
+      ldName = expLdName.get();
+    }
+    eld::Expected<LDSymbol *> expSym =
+        createSymbol(strTab, rawSym, idx, PatchableSymbols.contains(ldName));
     ELDEXP_RETURN_DIAGENTRY_IF_ERROR(expSym);
   }
+  // Symbol names are not needed anymore once the symbols are created.
+  m_DecodedSymNames = std::vector<llvm::StringRef>();
   return true;
 }
 
+template <class ELFT> eld::Expected<bool> ELFReader<ELFT>::decodeTables() {
+  ASSERT(m_LLVMELFFile, "m_LLVMELFFile must be initialized!");
+  if (!m_RawSectHdrs)
+    LLVMEXP_EXTRACT_AND_CHECK(m_RawSectHdrs, m_LLVMELFFile->sections());
+  ASSERT(m_RawSectHdrs, "m_RawSectHdrs must be initialized!");
+
+  if (m_RawSectHdrs->empty())
+    return true;
+
+  llvm::Expected<llvm::StringRef> expSectStrTab =
+      m_LLVMELFFile->getSectionStringTable(*m_RawSectHdrs);
+  LLVMEXP_RETURN_DIAGENTRY_IF_ERROR(expSectStrTab);
+  llvm::StringRef sectStrTab = expSectStrTab.get();
+
+  std::vector<llvm::StringRef> sectNames;
+  std::vector<LDFileFormat::Kind> sectKinds;
+  sectNames.reserve(m_RawSectHdrs->size());
+  sectKinds.reserve(m_RawSectHdrs->size());
+  for (std::size_t i = 0; i < m_RawSectHdrs->size(); ++i) {
+    const Elf_Shdr &rawSectHdr = (*m_RawSectHdrs)[i];
+    llvm::Expected<llvm::StringRef> expSectName =
+        m_LLVMELFFile->getSectionName(rawSectHdr, sectStrTab);
+    LLVMEXP_RETURN_DIAGENTRY_IF_ERROR(expSectName);
+    sectNames.push_back(expSectName.get());
+    // Unsupported sections are diagnosed when the section headers are read,
+    // so that the diagnostics are raised in input order.
+    sectKinds.push_back(
+        getSectionKind(rawSectHdr, expSectName.get(), /*diagnose=*/false));
+
+    // Split merge string sections into strings. Sections that need to be
+    // decompressed, or that are not null terminated, are split when read.
+    // Sections of fixed-size constants are split by their entry size.
+    if (sectKinds.back() == LDFileFormat::MergeStr &&
+        (rawSectHdr.sh_flags & llvm::ELF::SHF_STRINGS) &&
+        !(rawSectHdr.sh_flags & llvm::ELF::SHF_COMPRESSED))
+      decodeMergeStrings(i, rawSectHdr);
+
+    // Relocation tables that fail to decode are left alone, the error is
+    // reported when the relocation section is read.
+    if (rawSectHdr.sh_type == llvm::ELF::SHT_RELA) {
+      auto expRelas = m_LLVMELFFile->relas(rawSectHdr);
+      if (expRelas)
+        m_DecodedRelas[i] = expRelas.get();
+      else
+        llvm::consumeError(expRelas.takeError());
+    } else if (rawSectHdr.sh_type == llvm::ELF::SHT_REL) {
+      auto expRels = m_LLVMELFFile->rels(rawSectHdr);
+      if (expRels)
+        m_DecodedRels[i] = expRels.get();
+      else
+        llvm::consumeError(expRels.takeError());
+    }
+  }
+
+  const Elf_Shdr *symTabSec = findSection(
+      m_RawSectHdrs.value(),
+      (m_InputFile.getKind() == InputFile::InputFileKind::ELFDynObjFileKind
+           ? llvm::ELF::SHT_DYNSYM
+           : llvm::ELF::SHT_SYMTAB));
+  if (symTabSec) {
+    auto expElfSyms = m_LLVMELFFile->symbols(symTabSec);
+    LLVMEXP_RETURN_DIAGENTRY_IF_ERROR(expElfSyms);
+    llvm::ArrayRef<Elf_Sym> elfSyms = expElfSyms.get();
+    llvm::Expected<llvm::StringRef> expStrTab =
+        m_LLVMELFFile->getStringTableForSymtab(*symTabSec);
+    LLVMEXP_RETURN_DIAGENTRY_IF_ERROR(expStrTab);
+    llvm::StringRef strTab = expStrTab.get();
+    std::vector<llvm::StringRef> symNames;
+    symNames.reserve(elfSyms.size());
+    for (const Elf_Sym &rawSym : elfSyms) {
+      llvm::Expected<llvm::StringRef> expName = rawSym.getName(strTab);
+      LLVMEXP_RETURN_DIAGENTRY_IF_ERROR(expName);
+      symNames.push_back(expName.get());
+    }
+    m_DecodedSymNames = std::move(symNames);
+  }
+
+  m_DecodedSectNames = std::move(sectNames);
+  m_DecodedSectKinds = std::move(sectKinds);
+  return true;
+}
+
+template <class ELFT>
+void ELFReader<ELFT>::decodeMergeStrings(uint32_t sectIdx,
+                                         const Elf_Shdr &rawSectHdr) {
+  llvm::Expected<llvm::ArrayRef<uint8_t>> expContents =
+      m_LLVMELFFile->getSectionContents(rawSectHdr);
+  if (!expContents) {
+    llvm::consumeError(expContents.takeError());
+    return;
+  }
+  llvm::StringRef contents = llvm::toStringRef(expContents.get());
+  DecodedMergeStrings strings;
+  while (!contents.empty()) {
+    size_t end = contents.find('\0');
+    if (end == llvm::StringRef::npos)
+      return;
+    strings.Sizes.push_back(end + 1);
+    strings.Hashes.push_back(MergeableString::hash(contents.slice(0, end + 1)));
+    contents = contents.drop_front(end + 1);
+  }
+  m_DecodedMergeStrings[sectIdx] = std::move(strings);
+}
+
 template <class ELFT> std::string ELFReader<ELFT>::getFlagString() const {
   ASSERT(m_LLVMELFFile, "m_LLVMELFFile must be initialized!");
   GNULDBackend &backend = *m_Module.getBackend();
@@ -550,9 +665,17 @@ eld::Expected<bool> ELFReader<ELFT>::readMergeStringSection(ELFSection *S) {
   llvm::StringRef Contents = S->getContents();
   if (Contents.empty())
     return true;
-  MergeStringFragment *F = make<MergeStringFragment>(S);
-  if (!F->readStrings(config))
-    return false;
+  MergeStringFragment *F = nullptr;
+  if (S->isMergeStr()) {
+    F = make<MergeStringFragment>(S);
+    if (!F->readStrings(config))
+      return false;
+  } else {
+    auto *Constants = make<MergeConstantFragment>(S);
+    if (!Constants->readConstants(config))
+      return false;
+    F = Constants;
+  }
   S->addFragment(F);
   LayoutInfo *layoutInfo = this->m_Module.getLayoutInfo();
   if (layoutInfo)
@@ -22,13 +22,46 @@ using namespace eld;
 
 ELFRelocObjParser::ELFRelocObjParser(Module &module) : m_Module(module) {}
 
-eld::Expected<bool> ELFRelocObjParser::parseFile(InputFile &inputFile,
-                                                 bool &ELFOverriddenWithBC) {
+void ELFRelocObjParser::decodeFile(InputFile &inputFile) {
   eld::Expected<std::unique_ptr<ELFReaderBase>> expReader =
       ELFReaderBase::Create(m_Module, inputFile);
-  ELDEXP_RETURN_DIAGENTRY_IF_ERROR(expReader);
-
+  if (!expReader)
+    return;
   std::unique_ptr<ELFReaderBase> ELFReader = std::move(expReader.value());
+  eld::Expected<bool> expDecode = ELFReader->decodeTables();
+  if (!expDecode || !expDecode.value())
+    return;
+  keepDecodedReader(std::move(ELFReader));
+}
+
+std::unique_ptr<ELFReaderBase>
+ELFRelocObjParser::takeDecodedReader(const InputFile &inputFile) {
+  std::lock_guard<std::mutex> Guard(m_DecodedReadersMutex);
+  auto iter = m_DecodedReaders.find(&inputFile);
+  if (iter == m_DecodedReaders.end())
+    return nullptr;
+  std::unique_ptr<ELFReaderBase> ELFReader = std::move(iter->second);
+  m_DecodedReaders.erase(iter);
+  return ELFReader;
+}
+
+void ELFRelocObjParser::keepDecodedReader(
+    std::unique_ptr<ELFReaderBase> reader) {
+  std::lock_guard<std::mutex> Guard(m_DecodedReadersMutex);
+  const InputFile *inputFile = reader->getInputFile();
+  m_DecodedReaders[inputFile] = std::move(reader);
+}
+
+eld::Expected<bool> ELFRelocObjParser::parseFile(InputFile &inputFile,
+                                                 bool &ELFOverriddenWithBC) {
+  std::unique_ptr<ELFReaderBase> ELFReader = takeDecodedReader(inputFile);
+  bool isDecoded = ELFReader != nullptr;
+  if (!ELFReader) {
+    eld::Expected<std::unique_ptr<ELFReaderBase>> expReader =
+        ELFReaderBase::Create(m_Module, inputFile);
+    ELDEXP_RETURN_DIAGENTRY_IF_ERROR(expReader);
+    ELFReader = std::move(expReader.value());
+  }
 
   auto expCompatibility = ELFReader->isCompatible();
   ELDEXP_RETURN_DIAGENTRY_IF_ERROR(expCompatibility);
@@ -69,6 +102,10 @@ eld::Expected<bool> ELFRelocObjParser::parseFile(InputFile &inputFile,
   if (!expReadGroups.value())
     return false;
 
+  // Keep the decoded relocation tables until the relocations are read.
+  if (isDecoded)
+    keepDecodedReader(std::move(ELFReader));
+
   return true;
 }
 
@@ -471,11 +508,13 @@ eld::Expected<bool> ELFRelocObjParser::readGroups(ELFReaderBase &ELFReader) {
 }
 
 eld::Expected<bool> ELFRelocObjParser::readRelocations(InputFile &inputFile) {
-  eld::Expected<std::unique_ptr<ELFReaderBase>> expReader =
-      ELFReaderBase::Create(m_Module, inputFile);
-  ELDEXP_RETURN_DIAGENTRY_IF_ERROR(expReader);
-
-  std::unique_ptr<ELFReaderBase> ELFReader = std::move(expReader.value());
+  std::unique_ptr<ELFReaderBase> ELFReader = takeDecodedReader(inputFile);
+  if (!ELFReader) {
+    eld::Expected<std::unique_ptr<ELFReaderBase>> expReader =
+        ELFReaderBase::Create(m_Module, inputFile);
+    ELDEXP_RETURN_DIAGENTRY_IF_ERROR(expReader);
+    ELFReader = std::move(expReader.value());
+  }
 
   ELFObjectFile *EObj = llvm::cast<ELFObjectFile>(ELFReader->getInputFile());
   for (ELFSection *S : EObj->getRelocationSections()) {
@@ -18,16 +18,12 @@
 #include "eld/Readers/EhFrameSection.h"
 #include "eld/Readers/Relocation.h"
 #include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallVector.h"
 #include "llvm/Support/Endian.h"
 
 using namespace eld;
 
-namespace {
-// CIE records are uniquified by their contents and personality functions
-llvm::DenseMap<std::pair<llvm::ArrayRef<uint8_t>, ResolveInfo *>, CIEFragment *>
-    CieMap;
-} // namespace
-
 EhFrameSection::EhFrameSection(std::string Name, DiagnosticEngine *E,
                                uint32_t Type, uint32_t Flags, uint32_t EntSize,
                                uint64_t Size)
@@ -40,8 +36,7 @@ size_t EhFrameSection::readEhRecordSize(size_t Off) {
   llvm::ArrayRef<uint8_t> D = Data.slice(Off);
 
   if (D.size() < 4) {
-    m_DiagEngine->raise(Diag::eh_frame_read_error)
-        << "CIE/FDE too small" << getInputFile()->getInput()->decoratedPath();
+    m_ReadError = "CIE/FDE too small";
     return -1;
   }
 
@@ -50,21 +45,19 @@ size_t EhFrameSection::readEhRecordSize(size_t Off) {
   // but we do not support that format yet.
   uint64_t V = llvm::support::endian::read32le(D.data());
   if (V == UINT32_MAX) {
-    m_DiagEngine->raise(Diag::eh_frame_read_error)
-        << "CIE/FDE too large" << getInputFile()->getInput()->decoratedPath();
+    m_ReadError = "CIE/FDE too large";
     return -1;
   }
   uint64_t Size = V + 4;
   if (Size > D.size()) {
-    m_DiagEngine->raise(Diag::eh_frame_read_error)
-        << "CIE/FDE ends past the end of the section"
-        << getInputFile()->getInput()->decoratedPath();
+    m_ReadError = "CIE/FDE ends past the end of the section";
     return -1;
   }
   return Size;
 }
 
 bool EhFrameSection::splitEhFrameSection() {
+  m_IsSplit = true;
   if (!size())
     return true;
 
@@ -78,13 +71,30 @@ bool EhFrameSection::splitEhFrameSection() {
   if (!m_EhFrame)
     return false;
 
+  // Pieces are read in offset order, so relocations sorted by offset are
+  // assigned to pieces with a single cursor.
+  llvm::SmallVector<Relocation *, 0> SortedRelocations(Relocations.begin(),
+                                                       Relocations.end());
+  auto ByOffset = [](const Relocation *A, const Relocation *B) {
+    return A->getOffset() < B->getOffset();
+  };
+  if (!llvm::is_sorted(SortedRelocations, ByOffset))
+    llvm::stable_sort(SortedRelocations, ByOffset);
+  auto NextReloc = SortedRelocations.begin();
+
   llvm::StringRef Data = m_EhFrame->getRegion();
   for (size_t Off = 0, End = Data.size(); Off != End;) {
     size_t Size = readEhRecordSize(Off);
     if (Size == (size_t)-1)
       return false;
 
-    Relocation *Reloc = getReloc(Off, Size);
+    while (NextReloc != SortedRelocations.end() &&
+           (*NextReloc)->getOffset() < Off)
+      ++NextReloc;
+    Relocation *Reloc = nullptr;
+    if (NextReloc != SortedRelocations.end() &&
+        (*NextReloc)->getOffset() < Off + Size)
+      Reloc = *NextReloc;
     m_EhFramePieces.emplace_back(Off, Size, Reloc, this);
     if (Reloc && getDiagPrinter()->isVerbose())
       m_DiagEngine->raise(Diag::verbose_ehframe)
@@ -97,14 +107,15 @@ bool EhFrameSection::splitEhFrameSection() {
   return true;
 }
 
-Relocation *EhFrameSection::getReloc(size_t Off, size_t Size) {
-  for (auto &R : Relocations) {
-    if (R->getOffset() < Off)
-      continue;
-    if (R->getOffset() < Off + Size)
-      return R;
-  }
-  return nullptr;
+EhFramePiece *EhFrameSection::findPiece(size_t Offset) {
+  if (m_EhFramePieces.empty())
+    return nullptr;
+  auto I = llvm::partition_point(m_EhFramePieces, [Offset](EhFramePiece &P) {
+    return P.getOffset() + P.getSize() <= Offset;
+  });
+  if (I == m_EhFramePieces.end())
+    return &m_EhFramePieces.back();
+  return &*I;
 }
 
 bool EhFrameSection::createCIEAndFDEFragments() {
@@ -122,9 +133,7 @@ bool EhFrameSection::createCIEAndFDEFragments() {
     uint32_t CieOffset = Offset + 4 - ID;
     CIEFragment *Cie = m_OffsetToCie[CieOffset];
     if (!Cie) {
-      m_DiagEngine->raise(Diag::eh_frame_read_error)
-          << "Invalid CIE Reference"
-          << getInputFile()->getInput()->decoratedPath();
+      m_ReadError = "Invalid CIE Reference";
       return false;
     }
 
@@ -145,18 +154,19 @@ bool EhFrameSection::createCIEAndFDEFragments() {
   return true;
 }
 
+void EhFrameSection::raiseReadError() const {
+  m_DiagEngine->raise(Diag::eh_frame_read_error)
+      << m_ReadError << getInputFile()->getInput()->decoratedPath();
+}
+
+// Every CIE gets its own fragment. CIEs are not merged across sections, so
+// that the FDEs of a section are only attached to the CIEs of that section.
 CIEFragment *EhFrameSection::addCie(EhFramePiece &P) {
-  ResolveInfo *R = nullptr;
-  if (P.getRelocation())
-    R = P.getRelocation()->symInfo();
-  CIEFragment *E = CieMap[{P.getData(), R}];
-  if (!E) {
-    if (getDiagPrinter()->isVerbose())
-      m_DiagEngine->raise(Diag::verbose_ehframe_read_cie)
-          << "Reading CIE of size " + std::to_string(P.getSize());
-    E = make<eld::CIEFragment>(P, this);
-    m_CIEFragments.push_back(E);
-  }
+  if (getDiagPrinter()->isVerbose())
+    m_DiagEngine->raise(Diag::verbose_ehframe_read_cie)
+        << "Reading CIE of size " + std::to_string(P.getSize());
+  CIEFragment *E = make<eld::CIEFragment>(P, this);
+  m_CIEFragments.push_back(E);
   return E;
 }
 
@@ -8,6 +8,7 @@
 #include "eld/Config/LinkerConfig.h"
 #include "eld/Core/Module.h"
 #include "eld/Diagnostics/DiagnosticEngine.h"
+#include "eld/Fragment/MergeConstantFragment.h"
 #include "eld/Fragment/MergeStringFragment.h"
 #include "eld/Input/ELFObjectFile.h"
 #include "eld/Input/InputFile.h"
@@ -18,6 +19,7 @@
 #include "eld/SymbolResolver/Resolver.h"
 #include "eld/Target/GNULDBackend.h"
 #include "eld/Target/LDFileFormat.h"
+#include "eld/Target/Relocator.h"
 #include "llvm/BinaryFormat/ELF.h"
 #include "llvm/Support/Compression.h"
 #include <cstdint>
@@ -46,7 +48,6 @@ RelocELFReader<ELFT>::Create(Module &module, InputFile &inputFile) {
 template <class ELFT>
 eld::Expected<ELFSection *> RelocELFReader<ELFT>::createSection(
     typename ELFReader<ELFT>::Elf_Shdr rawSectHdr) {
-  Module &module = this->m_Module;
   eld::Expected<std::string> expSectName = this->getSectionName(rawSectHdr);
   ELDEXP_RETURN_DIAGENTRY_IF_ERROR(expSectName);
   std::string sectName = expSectName.value();
@@ -54,6 +55,14 @@ eld::Expected<ELFSection *> RelocELFReader<ELFT>::createSection(
   // Setup all section properties.
   // FIXME: sectName can be extracted from rawSectHdr.
   LDFileFormat::Kind kind = this->getSectionKind(rawSectHdr, sectName);
+  return createSection(rawSectHdr, sectName, kind);
+}
+
+template <class ELFT>
+ELFSection *RelocELFReader<ELFT>::createSection(
+    typename ELFReader<ELFT>::Elf_Shdr rawSectHdr, const std::string &sectName,
+    LDFileFormat::Kind kind) {
+  Module &module = this->m_Module;
 
   // FIXME: Emit some diagnostic here.
   if (kind == LDFileFormat::Error)
@@ -94,15 +103,31 @@ eld::Expected<bool> RelocELFReader<ELFT>::readSectionHeaders() {
   if (this->m_RawSectHdrs->empty())
     return true;
 
-  /// Create all sections, including the first null section.
-  for (const typename ELFReader<ELFT>::Elf_Shdr &rawSectHdr :
-       this->m_RawSectHdrs.value()) {
-    eld::Expected<ELFSection *> expSection = this->createSection(rawSectHdr);
-    ELDEXP_RETURN_DIAGENTRY_IF_ERROR(expSection);
-    ELFSection *S = expSection.value();
+  /// Create all sections, including the first null section. Use the section
+  /// names and kinds computed by decodeTables if they are available.
+  bool hasDecodedSections =
+      this->m_DecodedSectNames.size() == this->m_RawSectHdrs->size();
+  for (std::size_t i = 0; i < this->m_RawSectHdrs->size(); ++i) {
+    const typename ELFReader<ELFT>::Elf_Shdr &rawSectHdr =
+        (*this->m_RawSectHdrs)[i];
+    ELFSection *S = nullptr;
+    if (hasDecodedSections) {
+      LDFileFormat::Kind kind = this->m_DecodedSectKinds[i];
+      if (kind == LDFileFormat::Error)
+        this->m_Module.getConfig().raise(Diag::err_unsupported_section)
+            << this->m_DecodedSectNames[i]
+            << static_cast<uint32_t>(rawSectHdr.sh_type);
+      S = createSection(rawSectHdr, this->m_DecodedSectNames[i].str(), kind);
+    } else {
+      eld::Expected<ELFSection *> expSection = this->createSection(rawSectHdr);
+      ELDEXP_RETURN_DIAGENTRY_IF_ERROR(expSection);
+      S = expSection.value();
+    }
     this->setSectionInInputFile(S, rawSectHdr);
     this->setSectionAttributes(S, rawSectHdr);
   }
+  this->m_DecodedSectNames = std::vector<llvm::StringRef>();
+  this->m_DecodedSectKinds = std::vector<LDFileFormat::Kind>();
 
   this->setLinkInfoAttributes();
   // FIXME: This doesn't return the result of verifyFile to maintain
@@ -243,9 +268,23 @@ RelocELFReader<ELFT>::readMergeStringSection(ELFSection *S) {
   llvm::StringRef Contents = S->getContents();
   if (Contents.empty())
     return true;
-  MergeStringFragment *F = make<MergeStringFragment>(S);
-  if (!F->readStrings(config))
-    return false;
+  MergeStringFragment *F = nullptr;
+  auto I = this->m_DecodedMergeStrings.find(S->getIndex());
+  if (!S->isMergeStr()) {
+    auto *Constants = make<MergeConstantFragment>(S);
+    if (!Constants->readConstants(config))
+      return false;
+    F = Constants;
+  } else if (I != this->m_DecodedMergeStrings.end()) {
+    F = make<MergeStringFragment>(S);
+    if (!F->readStrings(config, I->second.Sizes, I->second.Hashes))
+      return false;
+    this->m_DecodedMergeStrings.erase(I);
+  } else {
+    F = make<MergeStringFragment>(S);
+    if (!F->readStrings(config))
+      return false;
+  }
   S->addFragment(F);
   LayoutInfo *layoutInfo = this->m_Module.getLayoutInfo();
   if (layoutInfo)
@@ -334,6 +373,10 @@ RelocELFReader<ELFT>::readRelocationSection(ELFSection *RS) {
   auto relRange = std::move(expRelRange.value());
 
   GNULDBackend &backend = *(this->m_Module.getBackend());
+  auto *linkSect = llvm::dyn_cast_or_null<ELFSection>(RS->getLink());
+  if (!backend.mayHandleRelocations(linkSect))
+    return readRelocations<isRela>(RS, relRange);
+
   InputFile *inputFile = this->getInputFile();
   ELFObjectFile *EObj = llvm::cast<ELFObjectFile>(inputFile);
 
@@ -359,7 +402,6 @@ RelocELFReader<ELFT>::readRelocationSection(ELFSection *RS) {
         section->setWanted(true);
     }
 
-    auto *linkSect = llvm::dyn_cast_or_null<ELFSection>(RS->getLink());
     Relocation::Type rType =
         ELFReader<ELFT>::template getRelocationType<isRela>(R);
     typename ELFReader<ELFT>::intX_t rAddend = ELFReader<ELFT>::getAddend(R);
@@ -375,6 +417,70 @@ RelocELFReader<ELFT>::readRelocationSection(ELFSection *RS) {
   return backend.handlePendingRelocations(RS->getLink());
 }
 
+template <class ELFT>
+template <bool isRela>
+eld::Expected<bool> RelocELFReader<ELFT>::readRelocations(
+    ELFSection *RS,
+    const typename ELFReader<ELFT>::template RelRangeType<isRela> &relRange) {
+  GNULDBackend &backend = *(this->m_Module.getBackend());
+  const Relocator *relocator = backend.getRelocator();
+  InputFile *inputFile = this->getInputFile();
+  ELFObjectFile *EObj = llvm::cast<ELFObjectFile>(inputFile);
+  auto *linkSect = llvm::cast<ELFSection>(RS->getLink());
+  const size_t numRelocs = relRange.size();
+
+  // Split r_info of all records first. This loop only shifts and masks, so it
+  // can be vectorized.
+  llvm::SmallVector<uint32_t, 0> rSyms(numRelocs);
+  llvm::SmallVector<Relocation::Type, 0> rTypes(numRelocs);
+  for (size_t I = 0; I != numRelocs; ++I) {
+    const auto &R = relRange[I];
+    rSyms[I] = R.getSymbol(/*isMips=*/false);
+    rTypes[I] = ELFReader<ELFT>::template getRelocationType<isRela>(R);
+  }
+
+  // The same as IRBuilder::addRelocation, with the place fragment and the
+  // relocation sizes looked up once per section instead of once per record.
+  Fragment *frag = linkSect->hasSectionData()
+                       ? linkSect->getFragmentList().front()
+                       : nullptr;
+  llvm::SmallDenseMap<Relocation::Type, Relocation::Size, 16> relocSizes;
+  linkSect->reserveRelocations(numRelocs);
+  for (size_t I = 0; I != numRelocs; ++I) {
+    LDSymbol *symbol = EObj->getSymbol(rSyms[I]);
+    if (!symbol) {
+      return std::make_unique<plugin::DiagnosticEntry>(plugin::DiagnosticEntry(
+          Diag::err_cannot_read_symbol,
+          {std::to_string(rSyms[I]),
+           inputFile->getInput()->getResolvedPath().getFullPath()}));
+    }
+    if (EObj->isLTOObject())
+      symbol = fixWrapSyms(symbol);
+
+    ResolveInfo *rInfo = symbol->resolveInfo();
+    if (!rInfo)
+      continue;
+    if (rInfo->type() == ResolveInfo::Section) {
+      ELFSection *section = EObj->getELFSection(symbol->sectionIndex());
+      if (section)
+        section->setWanted(true);
+    }
+
+    Relocation::Type rType = rTypes[I];
+    auto sizeIt = relocSizes.try_emplace(rType, 0);
+    if (sizeIt.second)
+      sizeIt.first->second = relocator->getSize(rType);
+
+    const auto &R = relRange[I];
+    FragmentRef fragRef = frag ? FragmentRef(*frag, R.r_offset) : FragmentRef();
+    Relocation *relocation = Relocation::Create(
+        rType, sizeIt.first->second, &fragRef, ELFReader<ELFT>::getAddend(R));
+    relocation->setSymInfo(rInfo);
+    linkSect->addRelocation(relocation);
+  }
+  return backend.handlePendingRelocations(linkSect);
+}
+
 template <class ELFT>
 LDSymbol *RelocELFReader<ELFT>::fixWrapSyms(LDSymbol *sym) {
   llvm::StringRef name(sym->name());
@@ -6,19 +6,104 @@
 
 #include "eld/Support/Memory.h"
 #include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallString.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/Support/Format.h"
+#include <algorithm>
+#include <cstring>
+#include <mutex>
 
 using namespace llvm;
 using namespace eld;
 
 BumpPtrAllocator eld::BAlloc;
-StringSaver eld::Saver{BAlloc};
+ConcurrentStringSaver eld::Saver;
 std::vector<SpecificAllocBase *> eld::SpecificAllocBase::Instances;
+
+static std::mutex &getInstancesMutex() {
+  static std::mutex Mutex;
+  return Mutex;
+}
+
+void SpecificAllocBase::registerInstance(SpecificAllocBase *Alloc) {
+  std::lock_guard<std::mutex> Guard(getInstancesMutex());
+  Instances.push_back(Alloc);
+}
+
+BumpAlloc &eld::getThreadBumpAlloc() {
+  static thread_local BumpAlloc *Alloc = new BumpAlloc();
+  return *Alloc;
+}
+
+StringRef ConcurrentStringSaver::save(StringRef S) {
+  BumpAlloc &A = getThreadBumpAlloc();
+  A.BytesAllocated += S.size() + 1;
+  ++A.NumAllocations;
+  char *P = A.Alloc.Allocate<char>(S.size() + 1);
+  if (!S.empty())
+    std::memcpy(P, S.data(), S.size());
+  P[S.size()] = '\0';
+  return StringRef(P, S.size());
+}
+
+StringRef ConcurrentStringSaver::save(const Twine &S) {
+  SmallString<128> Storage;
+  return save(S.toStringRef(Storage));
+}
+
 void eld::freeArena() {
-  for (SpecificAllocBase *Alloc : llvm::reverse(SpecificAllocBase::Instances))
+  std::lock_guard<std::mutex> Guard(getInstancesMutex());
+  for (SpecificAllocBase *Alloc : llvm::reverse(SpecificAllocBase::Instances)) {
     Alloc->reset();
+    Alloc->BytesAllocated = 0;
+    Alloc->NumAllocations = 0;
+  }
   BAlloc.Reset();
 }
 
+void eld::printArenaStats(llvm::raw_ostream &OS) {
+  struct TypeStats {
+    uint64_t Bytes = 0;
+    uint64_t Count = 0;
+  };
+  llvm::StringMap<TypeStats> ByType;
+  uint64_t TotalBytes = 0;
+  {
+    std::lock_guard<std::mutex> Guard(getInstancesMutex());
+    for (SpecificAllocBase *Alloc : SpecificAllocBase::Instances) {
+      if (!Alloc->NumAllocations)
+        continue;
+      TypeStats &S = ByType[Alloc->TypeName];
+      S.Bytes += Alloc->BytesAllocated;
+      S.Count += Alloc->NumAllocations;
+      TotalBytes += Alloc->BytesAllocated;
+    }
+  }
+  std::vector<std::pair<StringRef, TypeStats>> Sorted;
+  for (auto &E : ByType)
+    Sorted.push_back({E.getKey(), E.getValue()});
+  std::stable_sort(Sorted.begin(), Sorted.end(),
+                   [](const auto &A, const auto &B) {
+                     if (A.second.Bytes != B.second.Bytes)
+                       return A.second.Bytes > B.second.Bytes;
+                     return A.first < B.first;
+                   });
+
+  OS << "===" << std::string(73, '-') << "===\n";
+  OS << "                          Arena Memory Usage\n";
+  OS << "===" << std::string(73, '-') << "===\n";
+  OS << "  Total Bytes Allocated: " << TotalBytes << "\n\n";
+  OS << "      Bytes      Count  Type\n";
+  for (const auto &E : Sorted)
+    OS << llvm::format("%11llu %10llu  ", (unsigned long long)E.second.Bytes,
+                       (unsigned long long)E.second.Count)
+       << E.first << "\n";
+  OS << "\n";
+}
+
 const char *eld::getUninitBuffer(uint32_t Sz) {
-  return BAlloc.Allocate<char>(Sz);
+  BumpAlloc &A = getThreadBumpAlloc();
+  A.BytesAllocated += Sz;
+  ++A.NumAllocations;
+  return A.Alloc.Allocate<char>(Sz);
 }
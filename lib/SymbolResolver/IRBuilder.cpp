@@ -425,13 +425,12 @@ Relocation *IRBuilder::addRelocation(const Relocator *CurRelocator,
   if (!ResolveInfo)
     return nullptr;
 
-  FragmentRef *FragRef = FragmentRef::null();
-  if (CurSection->hasSectionData()) {
-    Fragment *Frag = CurSection->getFragmentList().front();
-    FragRef = make<FragmentRef>(*Frag, POffset);
-  }
-  Relocation *Relocation =
-      Relocation::Create(Type, CurRelocator->getSize(Type), FragRef, CurAddend);
+  // The relocation keeps its own copy of the place being relocated.
+  FragmentRef FragRef;
+  if (CurSection->hasSectionData())
+    FragRef = FragmentRef(*CurSection->getFragmentList().front(), POffset);
+  Relocation *Relocation = Relocation::Create(
+      Type, CurRelocator->getSize(Type), &FragRef, CurAddend);
 
   Relocation->setSymInfo(PSym.resolveInfo());
 
@@ -452,10 +451,10 @@ Relocation *IRBuilder::addRelocation(const Relocator *CurRelocator,
       ResolveInfo::Undefined == ResolveInfo->desc())
     return nullptr;
 
-  FragmentRef *FragRef = make<FragmentRef>(CurFrag, POffset);
+  FragmentRef FragRef(CurFrag, POffset);
 
-  Relocation *Relocation =
-      Relocation::Create(Type, CurRelocator->getSize(Type), FragRef, CurAddend);
+  Relocation *Relocation = Relocation::Create(
+      Type, CurRelocator->getSize(Type), &FragRef, CurAddend);
 
   Relocation->setSymInfo(PSym.resolveInfo());
 
@@ -477,10 +476,10 @@ Relocation *IRBuilder::createRelocation(const Relocator *CurRelocator,
       ResolveInfo::Undefined == ResolveInfo->desc())
     return nullptr;
 
-  FragmentRef *FragRef = make<FragmentRef>(CurFrag, POffset);
+  FragmentRef FragRef(CurFrag, POffset);
 
   Relocation *Relocation =
-      make<eld::Relocation>(CurRelocator, Type, FragRef, CurAddend);
+      make<eld::Relocation>(CurRelocator, Type, &FragRef, CurAddend);
 
   Relocation->setSymInfo(PSym.resolveInfo());
 
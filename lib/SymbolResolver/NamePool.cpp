@@ -14,6 +14,7 @@
 #include "eld/SymbolResolver/NamePool.h"
 #include "eld/Diagnostics/DiagnosticPrinter.h"
 #include "eld/Fragment/FragmentRef.h"
+#include "eld/Input/ArchiveFile.h"
 #include "eld/Input/InputFile.h"
 #include "eld/LayoutMap/LayoutInfo.h"
 #include "eld/Plugin/PluginManager.h"
@@ -113,6 +114,7 @@ bool NamePool::insertSymbol(
   ResolveInfo *NewSymbol = nullptr;
   ResolveInfo *old_symbol = nullptr;
   auto I = GlobalSymbols.find(SymbolName);
+  notifyLazySymbols(SymbolName);
 
   // Setup the New symbol.
   llvm::StringRef SymName = Saver.save(SymbolName);
@@ -380,6 +382,7 @@ bool NamePool::insertNonLocalSymbol(ResolveInfo InputSymbolResolveInfo,
   bool Exist = false;
   llvm::StringRef SymName = InputSymbolResolveInfo.getName();
   auto I = GlobalSymbols.find(SymName);
+  notifyLazySymbols(SymName);
   ResolveInfo *OldSymbol = nullptr;
   if (I == GlobalSymbols.end()) {
     GlobalSymbols[SymName] = make<ResolveInfo>(InputSymbolResolveInfo);
@@ -480,3 +483,27 @@ void NamePool::addUndefinedELFSymbol(InputFile *I, std::string SymbolName,
       make<LDSymbol>(Result.Info, ThisConfig.options().gcSections());
   Result.Info->setOutSymbol(OutputSym);
 }
+
+void NamePool::addLazySymbol(llvm::StringRef SymbolName, ArchiveFile *Archive,
+                             uint32_t Idx) {
+  LazySymbols[SymbolName].push_back({Archive, Idx});
+  // The symbol may already be referenced.
+  if (GlobalSymbols.count(SymbolName))
+    Archive->addPendingSymbol(Idx);
+}
+
+void NamePool::notifyLazySymbols(llvm::StringRef SymbolName) {
+  if (LazySymbols.empty())
+    return;
+  // Inclusion of a wrapped symbol depends on the state of its __real_ symbol.
+  llvm::StringRef WrappedName = SymbolName;
+  if (WrappedName.consume_front("__real_"))
+    notifyLazySymbols(WrappedName);
+  auto I = LazySymbols.find(SymbolName);
+  if (I == LazySymbols.end())
+    return;
+  for (auto &L : I->second) {
+    if (L.first->getSymbolStatus(L.second) == ArchiveFile::Symbol::Unknown)
+      L.first->addPendingSymbol(L.second);
+  }
+}
@@ -27,17 +27,36 @@ static ResolveInfo GNullResolveInfo;
 // ResolveInfo
 //===----------------------------------------------------------------------===//
 ResolveInfo::ResolveInfo()
-    : SymbolSize(0), SymbolValue(0), ThisBitField(0), SymbolName(""),
-      SymbolAlias(nullptr), SymbolResolvedOrigin(nullptr) {
+    : SymbolSize(0), SymbolValue(0), ThisBitField(0), ReservedBits(0),
+      SymbolName(""), SymbolAlias(nullptr), SymbolResolvedOrigin(nullptr) {
   OutputSymbol = nullptr;
 }
 
 ResolveInfo::ResolveInfo(llvm::StringRef Name)
-    : SymbolSize(0), SymbolValue(0), ThisBitField(0), SymbolName(Name),
-      SymbolAlias(nullptr), SymbolResolvedOrigin(nullptr) {
+    : SymbolSize(0), SymbolValue(0), ThisBitField(0), ReservedBits(0),
+      SymbolName(Name), SymbolAlias(nullptr), SymbolResolvedOrigin(nullptr) {
   OutputSymbol = nullptr;
 }
 
+ResolveInfo::ResolveInfo(const ResolveInfo &Other)
+    : SymbolSize(Other.SymbolSize), SymbolValue(Other.SymbolValue),
+      OutputSymbol(Other.OutputSymbol), ThisBitField(Other.ThisBitField),
+      ReservedBits(Other.reserved()), SymbolName(Other.SymbolName),
+      SymbolAlias(Other.SymbolAlias),
+      SymbolResolvedOrigin(Other.SymbolResolvedOrigin) {}
+
+ResolveInfo &ResolveInfo::operator=(const ResolveInfo &Other) {
+  SymbolSize = Other.SymbolSize;
+  SymbolValue = Other.SymbolValue;
+  OutputSymbol = Other.OutputSymbol;
+  ThisBitField = Other.ThisBitField;
+  setReserved(Other.reserved());
+  SymbolName = Other.SymbolName;
+  SymbolAlias = Other.SymbolAlias;
+  SymbolResolvedOrigin = Other.SymbolResolvedOrigin;
+  return *this;
+}
+
 ResolveInfo::~ResolveInfo() {}
 
 void ResolveInfo::override(const ResolveInfo &PFrom, bool CurOverrideOrigin) {
@@ -59,6 +78,7 @@ void ResolveInfo::overrideAttributes(const ResolveInfo &PFrom) {
   bool PrevExportToDyn = exportToDyn();
   ThisBitField &= ~ResolveMask;
   ThisBitField |= (PFrom.ThisBitField & ResolveMask);
+  setReserved(PFrom.reserved());
   shouldPreserve(P);
   setVisibility(V);
   if (PrevExportToDyn && PFrom.canBePreemptible())
@@ -126,8 +146,12 @@ void ResolveInfo::setBinding(uint32_t Binding) {
 }
 
 void ResolveInfo::setReserved(uint32_t Reserved) {
-  ThisBitField &= ~ReservedMask;
-  ThisBitField |= ((Reserved << ReservedOffset) & ReservedMask);
+  ReservedBits.store(Reserved & 0xF);
+}
+
+bool ResolveInfo::reserve(uint32_t Reserved) {
+  Reserved &= 0xF;
+  return (ReservedBits.fetch_or(Reserved) & Reserved) != Reserved;
 }
 
 void ResolveInfo::setOther(uint32_t Other) {
@@ -225,7 +249,7 @@ uint32_t ResolveInfo::binding() const {
 }
 
 uint32_t ResolveInfo::reserved() const {
-  return (ThisBitField & ReservedMask) >> ReservedOffset;
+  return ReservedBits.load();
 }
 
 ResolveInfo::Visibility ResolveInfo::visibility() const {
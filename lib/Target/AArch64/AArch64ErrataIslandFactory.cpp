@@ -93,7 +93,7 @@ BranchIsland *AArch64ErrataIslandFactory::createAArch64ErrataIsland(
         (*it)->type(),
         pBuilder.getModule().getBackend()->getRelocator()->getSize(
             (*it)->type()),
-        make<FragmentRef>(*clone, (*it)->offset()), 0);
+        FragmentRef(*clone, (*it)->offset()), 0);
     if ((*it)->type() == llvm::ELF::R_AARCH64_JUMP26) {
       reloc->setSymInfo(returnSymbol->resolveInfo());
       reloc->target() = AArch64InsnHelpers::buildBranchInsn();
@@ -102,7 +102,7 @@ BranchIsland *AArch64ErrataIslandFactory::createAArch64ErrataIsland(
     island->addRelocation(*reloc);
   }
   Relocation *reloc = Relocation::Create(llvm::ELF::R_AARCH64_JUMP26, 32,
-                                         make<FragmentRef>(*frag, pOffset), 0);
+                                         FragmentRef(*frag, pOffset), 0);
   reloc->setSymInfo(symbol->resolveInfo());
   reloc->target() = AArch64InsnHelpers::buildBranchInsn();
   island->addRelocation(*reloc);
@@ -170,6 +170,7 @@ BranchIsland *AArch64ErrataIslandFactory::createAArch64ErrataIsland(
     curNodeIter = MatchedSection->getFragmentList().end();
   }
   MatchedSection->splice(curNodeIter, toBeInsertedFrags);
+  outputELFSection->getOutputSection()->setLayoutDirty();
   symbol->resolveInfo()->setResolvedOrigin(trampolineInput);
 
   // Set the owning section.
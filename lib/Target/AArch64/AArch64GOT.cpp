@@ -22,7 +22,7 @@ AArch64GOTPLT0 *AArch64GOTPLT0::Create(ELFSection *O, ResolveInfo *R) {
   Relocation *r1 = nullptr;
 
   r1 = Relocation::Create(llvm::ELF::R_AARCH64_ABS64, 64,
-                          make<FragmentRef>(*G, 0), 0);
+                          FragmentRef(*G, 0), 0);
   r1->setSymInfo(R);
 
   O->addRelocation(r1);
@@ -39,7 +39,7 @@ AArch64GOTPLTN *AArch64GOTPLTN::Create(ELFSection *O, ResolveInfo *R,
   if (PLT) {
     FragmentRef *PLTFragRef = make<FragmentRef>(*PLT, 0);
     Relocation *r = Relocation::Create(llvm::ELF::R_AARCH64_ABS64, 64,
-                                       make<FragmentRef>(*G, 0), 0);
+                                       FragmentRef(*G, 0), 0);
     O->addRelocation(r);
     r->modifyRelocationFragmentRef(PLTFragRef);
   }
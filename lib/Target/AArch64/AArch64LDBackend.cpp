@@ -38,12 +38,14 @@
 #include "eld/Target/ELFSegment.h"
 #include "eld/Target/ELFSegmentFactory.h"
 #include "eld/Target/TargetInfo.h"
+#include "llvm/ADT/DenseSet.h"
 #include "llvm/ADT/Twine.h"
 #include "llvm/BinaryFormat/ELF.h"
 #include "llvm/Object/ELFTypes.h"
 #include "llvm/Support/Casting.h"
 #include "llvm/Support/ErrorOr.h"
 #include "llvm/Support/FileSystem.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/Program.h"
 #include "llvm/TargetParser/Triple.h"
 #include <cstring>
@@ -333,7 +335,61 @@ void AArch64GNUInfoLDBackend::mayBeRelax(int pass, bool &pFinished) {
       pFinished = false;
   }
 
-  // check branch relocs and create the related stubs if needed
+  auto isBranchReloc = [](const Relocation *reloc) {
+    switch (reloc->type()) {
+    case llvm::ELF::R_AARCH64_CALL26:
+    case llvm::ELF::R_AARCH64_JUMP26:
+      return reloc->symInfo() && !reloc->symInfo()->isUndef();
+    default:
+      return false;
+    }
+  };
+
+  // Find the branches that need a stub, one output section at a time. This
+  // only reads the layout, so output sections are scanned concurrently.
+  std::vector<OutputSectionEntry *> OutSections;
+  for (auto &O : OutputSectionToFrags) {
+    if (O.first)
+      OutSections.push_back(O.first);
+  }
+  std::vector<std::vector<Relocation *>> StubRelocs(OutSections.size());
+
+  auto ScanBranchesForOutputSection = [&](size_t n) {
+    OutputSectionEntry *Out = OutSections.at(n);
+    eld::RegisterTimer T(Out->name(), "Trampoline Time",
+                         m_Module.getConfig().options().printTimingStats());
+    ELFSection *LastSection = nullptr;
+    for (auto &F : OutputSectionToFrags.at(Out)) {
+      ELFSection *S = F->getOwningSection();
+      if (S == LastSection)
+        continue;
+      LastSection = S;
+      for (auto &reloc : S->getRelocations()) {
+        if (!isBranchReloc(reloc))
+          continue;
+        if (getStubFactory()->isStubNeeded(*reloc, m_Module, *this))
+          StubRelocs[n].push_back(reloc);
+      }
+    }
+  };
+
+  if (config().options().numThreads() <= 1 ||
+      !config().isLinkerRelaxationMultiThreaded()) {
+    for (size_t I = 0; I < OutSections.size(); ++I)
+      ScanBranchesForOutputSection(I);
+  } else {
+    llvm::parallelFor((size_t)0, OutSections.size(),
+                      ScanBranchesForOutputSection);
+  }
+
+  llvm::DenseSet<const Relocation *> NeedsStub;
+  for (auto &Relocs : StubRelocs)
+    NeedsStub.insert(Relocs.begin(), Relocs.end());
+  if (NeedsStub.empty())
+    return;
+
+  // Create the stubs in input order, so that stub names and placement do not
+  // depend on how output sections were scheduled.
   Module::obj_iterator input, inEnd = m_Module.objEnd();
   for (input = m_Module.objBegin(); input != inEnd; ++input) {
     ELFObjectFile *ObjFile = llvm::dyn_cast<ELFObjectFile>(*input);
@@ -345,41 +401,31 @@ void AArch64GNUInfoLDBackend::mayBeRelax(int pass, bool &pFinished) {
       if (rs->isDiscard())
         continue;
       for (auto &reloc : rs->getLink()->getRelocations()) {
-        switch (reloc->type()) {
-        case llvm::ELF::R_AARCH64_CALL26:
-        case llvm::ELF::R_AARCH64_JUMP26: {
-          Relocation *relocation = llvm::cast<Relocation>(reloc);
-          if (!relocation->symInfo())
+        if (!NeedsStub.count(reloc))
+          continue;
+        Relocation *relocation = llvm::cast<Relocation>(reloc);
+        std::pair<BranchIsland *, bool> branchIsland =
+            getStubFactory()->create(*relocation, // relocation
+                                     *m_Module.getIRBuilder(),
+                                     *getBRIslandFactory(), *this);
+        if (branchIsland.first && !branchIsland.second) {
+          switch (config().options().getStripSymbolMode()) {
+          case GeneralOptions::StripAllSymbols:
+          case GeneralOptions::StripLocals:
             break;
-          if (relocation->symInfo()->isUndef())
-            continue;
-          std::pair<BranchIsland *, bool> branchIsland =
-              getStubFactory()->create(*relocation, // relocation
-                                       *m_Module.getIRBuilder(),
-                                       *getBRIslandFactory(), *this);
-          if (branchIsland.first && !branchIsland.second) {
-            switch (config().options().getStripSymbolMode()) {
-            case GeneralOptions::StripAllSymbols:
-            case GeneralOptions::StripLocals:
-              break;
-            default: {
-              // a stub symbol should be local
-              ELFSection &symtab = *file_format->getSymTab();
-              ELFSection &strtab = *file_format->getStrTab();
-
-              // increase the size of .symtab and .strtab if needed
-              symtab.setSize(symtab.size() + sizeof(llvm::ELF::Elf64_Sym));
-              symtab.setInfo(symtab.getInfo() + 1);
-              strtab.setSize(strtab.size() +
-                             branchIsland.first->symInfo()->nameSize() + 1);
-            }
-            } // end of switch
-            pFinished = false;
+          default: {
+            // a stub symbol should be local
+            ELFSection &symtab = *file_format->getSymTab();
+            ELFSection &strtab = *file_format->getStrTab();
+
+            // increase the size of .symtab and .strtab if needed
+            symtab.setSize(symtab.size() + sizeof(llvm::ELF::Elf64_Sym));
+            symtab.setInfo(symtab.getInfo() + 1);
+            strtab.setSize(strtab.size() +
+                           branchIsland.first->symInfo()->nameSize() + 1);
           }
-        } break;
-
-        default:
-          break;
+          } // end of switch
+          pFinished = false;
         }
       }
     }
@@ -794,7 +840,7 @@ AArch64PLT *AArch64GNUInfoLDBackend::createPLT(ELFObjectFile *Obj,
   Relocation &rela_entry = *Obj->getRelaPLT()->createOneReloc();
   rela_entry.setType(isIRelative ? llvm::ELF::R_AARCH64_IRELATIVE
                                  : llvm::ELF::R_AARCH64_JUMP_SLOT);
-  rela_entry.setTargetRef(make<FragmentRef>(*P->getGOT(), 0));
+  rela_entry.setTargetRef(FragmentRef(*P->getGOT(), 0));
   if (isIRelative)
     P->getGOT()->setValueType(GOT::SymbolValue);
   rela_entry.setSymInfo(R);
@@ -808,6 +854,22 @@ void AArch64GNUInfoLDBackend::recordPLT(ResolveInfo *I, AArch64PLT *P) {
   m_PLTMap[I] = P;
 }
 
+void AArch64GNUInfoLDBackend::mergeScannedEntries(ELFObjectFile &Obj) {
+  auto *R = static_cast<AArch64Relocator *>(getRelocator());
+  for (const auto &G : Obj.getRequestedGOTs())
+    R->createRequestedGOT(Obj, *G.first, G.second);
+  for (const auto &P : Obj.getRequestedPLTs()) {
+    // An earlier file, or an earlier relocation of this file, may have
+    // requested the same entry.
+    if (findEntryInPLT(P.first))
+      continue;
+    createPLT(&Obj, P.first, P.second);
+    if (P.second)
+      defineIRelativeRange(*P.first);
+  }
+  GNULDBackend::mergeScannedEntries(Obj);
+}
+
 Stub *AArch64GNUInfoLDBackend::getBranchIslandStub(Relocation *pReloc,
                                                    int64_t targetValue) const {
   (void)pReloc;
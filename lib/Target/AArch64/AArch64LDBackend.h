@@ -105,6 +105,8 @@ public:
 
   AArch64PLT *findEntryInPLT(ResolveInfo *) const;
 
+  void mergeScannedEntries(ELFObjectFile &Obj) override;
+
   bool hasSymInfo(const Relocation *X) const override {
     if (X->type() == llvm::ELF::R_AARCH64_IRELATIVE)
       return false;
@@ -30,13 +30,13 @@ AArch64PLT0 *AArch64PLT0::Create(eld::IRBuilder &I, AArch64GOT *G,
   Relocation *r2 = nullptr;
   Relocation *r3 = nullptr;
   r1 = Relocation::Create(llvm::ELF::R_AARCH64_ADR_PREL_PG_HI21_NC, 32,
-                          make<FragmentRef>(*P, 0x4), 0x10);
+                          FragmentRef(*P, 0x4), 0x10);
   r1->setSymInfo(symbol->resolveInfo());
   r2 = Relocation::Create(llvm::ELF::R_AARCH64_LDST64_ABS_LO12_NC, 32,
-                          make<FragmentRef>(*P, 0x8), 0x10);
+                          FragmentRef(*P, 0x8), 0x10);
   r2->setSymInfo(symbol->resolveInfo());
   r3 = Relocation::Create(llvm::ELF::R_AARCH64_ADD_ABS_LO12_NC, 32,
-                          make<FragmentRef>(*P, 0xc), 0x10);
+                          FragmentRef(*P, 0xc), 0x10);
   r3->setSymInfo(symbol->resolveInfo());
   O->addRelocation(r1);
   O->addRelocation(r2);
@@ -63,13 +63,13 @@ AArch64PLTN *AArch64PLTN::Create(eld::IRBuilder &I, AArch64GOT *G,
   Relocation *r2 = nullptr;
   Relocation *r3 = nullptr;
   r1 = Relocation::Create(llvm::ELF::R_AARCH64_ADR_PREL_PG_HI21_NC, 32,
-                          make<FragmentRef>(*P, 0), 0);
+                          FragmentRef(*P, 0), 0);
   r1->setSymInfo(symbol->resolveInfo());
   r2 = Relocation::Create(llvm::ELF::R_AARCH64_LDST64_ABS_LO12_NC, 32,
-                          make<FragmentRef>(*P, 4), 0);
+                          FragmentRef(*P, 4), 0);
   r2->setSymInfo(symbol->resolveInfo());
   r3 = Relocation::Create(llvm::ELF::R_AARCH64_ADD_ABS_LO12_NC, 32,
-                          make<FragmentRef>(*P, 8), 0);
+                          FragmentRef(*P, 8), 0);
   r3->setSymInfo(symbol->resolveInfo());
   O->addRelocation(r1);
   O->addRelocation(r2);
@@ -17,9 +17,10 @@
 #include "eld/SymbolResolver/IRBuilder.h"
 #include "eld/SymbolResolver/LDSymbol.h"
 #include "eld/Target/ELFFileFormat.h"
+#include "eld/Target/RelocationTable.h"
 #include "llvm/ADT/Twine.h"
 #include "llvm/BinaryFormat/ELF.h"
-#include <map>
+#include <array>
 
 using namespace eld;
 
@@ -28,8 +29,7 @@ namespace {
 /// helper_DynRel - Get an relocation entry in .rela.dyn
 Relocation *helper_DynRel_init(ELFObjectFile *Obj, Relocation *R,
                                ResolveInfo *pSym, Fragment *F, uint32_t pOffset,
-                               Relocator::Type pType,
-                               AArch64GNUInfoLDBackend &B) {
+                               Relocator::Type pType) {
   Relocation *rela_entry = nullptr;
 
   if (pType == R_AARCH64_TLSDESC)
@@ -38,7 +38,7 @@ Relocation *helper_DynRel_init(ELFObjectFile *Obj, Relocation *R,
     rela_entry = Obj->getRelaDyn()->createOneReloc();
 
   rela_entry->setType(pType);
-  rela_entry->setTargetRef(make<FragmentRef>(*F, pOffset));
+  rela_entry->setTargetRef(FragmentRef(*F, pOffset));
   rela_entry->setSymInfo(pSym);
   if (R)
     rela_entry->setAddend(R->addend());
@@ -50,7 +50,7 @@ Relocation *helper_DynRel_init(ELFObjectFile *Obj, Relocation *R,
   // pointing to a merge string.
   if (R && (pType == llvm::ELF::R_AARCH64_RELATIVE ||
             pType == llvm::ELF::R_AARCH64_IRELATIVE)) {
-    B.recordRelativeReloc(rela_entry, R);
+    Obj->recordRelativeReloc(rela_entry, R);
   }
 
   return rela_entry;
@@ -73,8 +73,7 @@ AArch64GOT &CreateGOT(ELFObjectFile *Obj, Relocation &pReloc, bool pHasRel,
       (rsym->isHidden() || (!isExec && !B.isSymbolPreemptible(*rsym)));
   helper_DynRel_init(Obj, &pReloc, rsym, G, 0x0,
                      useRelative ? llvm::ELF::R_AARCH64_RELATIVE
-                                 : llvm::ELF::R_AARCH64_GLOB_DAT,
-                     B);
+                                 : llvm::ELF::R_AARCH64_GLOB_DAT);
   if (useRelative) {
     G->setValueType(GOT::SymbolValue);
   }
@@ -95,25 +94,25 @@ typedef Relocator::Result (*ApplyFunctionType)(Relocation &pReloc,
 // the table entry of applying functions
 class ApplyFunctionEntry {
 public:
-  ApplyFunctionEntry() {}
-  ApplyFunctionEntry(ApplyFunctionType pFunc, const char *pName,
-                     size_t pSize = 0)
+  constexpr ApplyFunctionEntry() {}
+  constexpr ApplyFunctionEntry(ApplyFunctionType pFunc, const char *pName,
+                               size_t pSize = 0)
       : func(pFunc), name(pName), size(pSize) {}
-  ApplyFunctionType func;
-  const char *name;
-  size_t size;
+  ApplyFunctionType func = nullptr;
+  const char *name = nullptr;
+  size_t size = 0;
 };
-typedef std::map<Relocator::Type, ApplyFunctionEntry> ApplyFunctionMap;
+typedef std::pair<Relocator::Type, ApplyFunctionEntry> ApplyFunctionListEntry;
 
-static const ApplyFunctionMap::value_type ApplyFunctionList[] = {
-    DECL_AARCH64_APPLY_RELOC_FUNC_PTRS(ApplyFunctionMap::value_type,
+static constexpr ApplyFunctionListEntry ApplyFunctionList[] = {
+    DECL_AARCH64_APPLY_RELOC_FUNC_PTRS(ApplyFunctionListEntry,
                                        ApplyFunctionEntry)};
 
-// declare the table of applying functions
-static ApplyFunctionMap ApplyFunctions(ApplyFunctionList,
-                                       ApplyFunctionList +
-                                           sizeof(ApplyFunctionList) /
-                                               sizeof(ApplyFunctionList[0]));
+// declare the table of applying functions, indexed by relocation type
+static constexpr std::array<ApplyFunctionEntry, AARCH64_MAXRELOCS>
+    ApplyFunctions =
+        createRelocationTable<ApplyFunctionEntry, AARCH64_MAXRELOCS>(
+            ApplyFunctionList);
 
 //===----------------------------------------------------------------------===//
 // AArch64Relocator
@@ -148,7 +147,8 @@ Relocator::Result AArch64Relocator::applyRelocation(Relocation &pRelocation) {
       (type != R_AARCH64_COPY_INSN))
     return Relocator::Unknown;
 
-  assert(ApplyFunctions.find(type) != ApplyFunctions.end());
+  if (!ApplyFunctions[type].func)
+    return Relocator::Unknown;
 
   ResolveInfo *symInfo = pRelocation.symInfo();
 
@@ -169,13 +169,14 @@ Relocator::Result AArch64Relocator::applyRelocation(Relocation &pRelocation) {
 }
 
 const char *AArch64Relocator::getName(Relocator::Type pType) const {
-  assert(ApplyFunctions.find(pType) != ApplyFunctions.end());
+  assert(pType < AARCH64_MAXRELOCS && ApplyFunctions[pType].name);
   return ApplyFunctions[pType].name;
 }
 
 uint32_t AArch64Relocator::getNumRelocs() const { return AARCH64_MAXRELOCS; }
 
 Relocator::Size AArch64Relocator::getSize(Relocation::Type pType) const {
+  assert(pType < AARCH64_MAXRELOCS);
   return ApplyFunctions[pType].size;
 }
 
@@ -190,14 +191,12 @@ void AArch64Relocator::scanLocalReloc(InputFile &pInput, Relocation &pReloc,
     // a dynamic relocations with RELATIVE type to this location is needed.
     // Reserve an entry in .rel.dyn
     if (config().isCodeIndep()) {
-      std::lock_guard<std::mutex> relocGuard(m_RelocMutex);
       // set Rel bit
-      rsym->setReserved(rsym->reserved() | ReserveRel);
+      rsym->reserve(ReserveRel);
       getTarget().checkAndSetHasTextRel(pSection);
       // set up the dyn rel directly
       helper_DynRel_init(Obj, &pReloc, rsym, pReloc.targetRef()->frag(),
-                         pReloc.targetRef()->offset(), R_AARCH64_RELATIVE,
-                         m_Target);
+                         pReloc.targetRef()->offset(), R_AARCH64_RELATIVE);
     }
     return;
 
@@ -207,72 +206,31 @@ void AArch64Relocator::scanLocalReloc(InputFile &pInput, Relocation &pReloc,
     // a dynamic relocations with RELATIVE type to this location is needed.
     // Reserve an entry in .rel.dyn
     if (config().isCodeIndep()) {
-      std::lock_guard<std::mutex> relocGuard(m_RelocMutex);
       // set up the dyn rel directly
       helper_DynRel_init(Obj, &pReloc, rsym, pReloc.targetRef()->frag(),
-                         pReloc.targetRef()->offset(), pReloc.type(), m_Target);
+                         pReloc.targetRef()->offset(), pReloc.type());
       // set Rel bit
-      rsym->setReserved(rsym->reserved() | ReserveRel);
+      rsym->reserve(ReserveRel);
       getTarget().checkAndSetHasTextRel(pSection);
     }
     return;
 
   case llvm::ELF::R_AARCH64_ADR_GOT_PAGE:
-  case llvm::ELF::R_AARCH64_LD64_GOT_LO12_NC: {
-    std::lock_guard<std::mutex> relocGuard(m_RelocMutex);
-    // Symbol needs GOT entry, reserve entry in .got
-    // return if we already create GOT for this symbol
-    if (rsym->reserved() & ReserveGOT)
-      return;
-    // If building PIC object, a dynamic relocation with
-    // type RELATIVE is needed to relocate this GOT entry.
-    CreateGOT(Obj, pReloc, config().isCodeIndep(), m_Target,
-              config().codeGenType() == LinkerConfig::Exec);
-    // set GOT bit
-    rsym->setReserved(rsym->reserved() | ReserveGOT);
+  case llvm::ELF::R_AARCH64_LD64_GOT_LO12_NC:
+  case llvm::ELF::R_AARCH64_TLSDESC_ADR_PAGE21:
+  case llvm::ELF::R_AARCH64_TLSDESC_LD64_LO12:
+  case llvm::ELF::R_AARCH64_TLSDESC_ADD_LO12:
+    // Symbol needs GOT entry, created by createRequestedGOT
+    Obj->requestGOT(&pReloc, pReloc.type());
     return;
-  }
 
   case llvm::ELF::R_AARCH64_TLSIE_ADR_GOTTPREL_PAGE21:
-  case llvm::ELF::R_AARCH64_TLSIE_LD64_GOTTPREL_LO12_NC: {
-    std::lock_guard<std::mutex> relocGuard(m_RelocMutex);
-    if (rsym->reserved() & ReserveGOT)
-      return;
-
+  case llvm::ELF::R_AARCH64_TLSIE_LD64_GOTTPREL_LO12_NC:
     // Dont use a GOT, convert the instruction.
     if (config().isCodeStatic())
       return;
-    AArch64GOT *G = m_Target.createGOT(GOT::TLS_IE, Obj, rsym);
-    helper_DynRel_init(Obj, &pReloc, rsym, G, 0x0,
-                       llvm::ELF::R_AARCH64_TLS_TPREL64, m_Target);
-    if (rsym->reserved() == Relocator::None)
-      rsym->setReserved(rsym->reserved() | ReserveGOT);
-    return;
-  }
-
-  case llvm::ELF::R_AARCH64_TLSDESC_ADR_PAGE21:
-  case llvm::ELF::R_AARCH64_TLSDESC_LD64_LO12:
-  case llvm::ELF::R_AARCH64_TLSDESC_ADD_LO12: {
-    std::lock_guard<std::mutex> relocGuard(m_RelocMutex);
-
-    // Symbol needs GOT entry, reserve entry in .got
-    // return if we already create GOT for this symbol
-    if (rsym->reserved() & ReserveGOT)
-      return;
-
-    if (config().isCodeStatic()) {
-      AArch64GOT *G = m_Target.createGOT(GOT::TLS_IE, Obj, rsym);
-      rsym->setReserved(rsym->reserved() | ReserveGOT);
-      G->setValueType(GOT::TLSStaticSymbolValue);
-      return;
-    }
-    AArch64GOT *G = m_Target.createGOT(GOT::TLS_DESC, Obj, rsym);
-    helper_DynRel_init(Obj, &pReloc, rsym, G->getFirst(), 0x0,
-                       llvm::ELF::R_AARCH64_TLSDESC, m_Target);
-    if (rsym->reserved() == Relocator::None)
-      rsym->setReserved(rsym->reserved() | ReserveGOT);
+    Obj->requestGOT(&pReloc, pReloc.type());
     return;
-  }
 
   default:
     break;
@@ -291,20 +249,16 @@ void AArch64Relocator::scanGlobalReloc(InputFile &pInput, Relocation &pReloc,
   case llvm::ELF::R_AARCH64_ABS16:
   case llvm::ELF::R_AARCH64_ABS32:
   case llvm::ELF::R_AARCH64_ABS64: {
-    std::lock_guard<std::mutex> relocGuard(m_RelocMutex);
     // Absolute relocation type, symbol may needs PLT entry or
     // dynamic relocation entry
     bool isSymbolPreemptible = m_Target.isSymbolPreemptible(*rsym);
     if (isSymbolPreemptible && (rsym->type() == ResolveInfo::Function)) {
       // create plt for this symbol if it does not have one
-      if (!(rsym->reserved() & ReservePLT)) {
-        // Symbol needs PLT entry, we need a PLT entry
-        // and the corresponding GOT and dynamic relocation entry
-        // in .got and .rel.plt.
-        m_Target.createPLT(Obj, rsym);
-        // set PLT bit
-        rsym->setReserved(rsym->reserved() | ReservePLT);
-      }
+      // Symbol needs PLT entry, we need a PLT entry
+      // and the corresponding GOT and dynamic relocation entry
+      // in .got and .rel.plt.
+      rsym->reserve(ReservePLT);
+      Obj->requestPLT(rsym, /*IsIRelative=*/false);
     }
 
     if (getTarget().symbolNeedsDynRel(
@@ -322,12 +276,12 @@ void AArch64Relocator::scanGlobalReloc(InputFile &pInput, Relocation &pReloc,
         CopyRelocs.insert(rsym);
       } else {
         // set Rel bit and the dyn rel
-        rsym->setReserved(rsym->reserved() | ReserveRel);
+        rsym->reserve(ReserveRel);
         getTarget().checkAndSetHasTextRel(pSection);
         helper_DynRel_init(
             Obj, &pReloc, rsym, pReloc.targetRef()->frag(),
             pReloc.targetRef()->offset(),
-            isSymbolPreemptible ? pReloc.type() : R_AARCH64_RELATIVE, m_Target);
+            isSymbolPreemptible ? pReloc.type() : R_AARCH64_RELATIVE);
       }
     }
   }
@@ -336,20 +290,16 @@ void AArch64Relocator::scanGlobalReloc(InputFile &pInput, Relocation &pReloc,
   case llvm::ELF::R_AARCH64_PREL64:
   case llvm::ELF::R_AARCH64_PREL32:
   case llvm::ELF::R_AARCH64_PREL16: {
-    std::lock_guard<std::mutex> relocGuard(m_RelocMutex);
     bool isSymbolPreemptible = m_Target.isSymbolPreemptible(*rsym);
     if (isSymbolPreemptible) {
       if ((rsym->type() == ResolveInfo::Function) &&
           LinkerConfig::DynObj != config().codeGenType()) {
         // create plt for this symbol if it does not have one
-        if (!(rsym->reserved() & ReservePLT)) {
-          // Symbol needs PLT entry, we need a PLT entry
-          // and the corresponding GOT and dynamic relocation entry
-          // in .got and .rel.plt.
-          m_Target.createPLT(Obj, rsym);
-          // set PLT bit
-          rsym->setReserved(rsym->reserved() | ReservePLT);
-        }
+        // Symbol needs PLT entry, we need a PLT entry
+        // and the corresponding GOT and dynamic relocation entry
+        // in .got and .rel.plt.
+        rsym->reserve(ReservePLT);
+        Obj->requestPLT(rsym, /*IsIRelative=*/false);
       }
     }
 
@@ -371,17 +321,10 @@ void AArch64Relocator::scanGlobalReloc(InputFile &pInput, Relocation &pReloc,
   case llvm::ELF::R_AARCH64_CONDBR19:
   case llvm::ELF::R_AARCH64_JUMP26:
   case llvm::ELF::R_AARCH64_CALL26: {
-    std::lock_guard<std::mutex> relocGuard(m_RelocMutex);
-    // return if we already create plt for this symbol
-    if (rsym->reserved() & ReservePLT)
-      return;
-
     // create IRELATIVE for IFUNC symbol
     if (rsym->type() == ResolveInfo::IndirectFunc && config().isCodeStatic()) {
-      m_Target.createPLT(Obj, rsym, true);
-      rsym->setReserved(rsym->reserved() | ReservePLT);
-      AArch64GNUInfoLDBackend &backend = getTarget();
-      backend.defineIRelativeRange(*rsym);
+      rsym->reserve(ReservePLT);
+      Obj->requestPLT(rsym, /*IsIRelative=*/true);
       return;
     }
     // if symbol is defined in the output file and it's not
@@ -393,15 +336,13 @@ void AArch64Relocator::scanGlobalReloc(InputFile &pInput, Relocation &pReloc,
     // Symbol needs PLT entry, we need to reserve a PLT entry
     // and the corresponding GOT and dynamic relocation entry
     // in .got and .rel.plt.
-    m_Target.createPLT(Obj, rsym);
-    // set PLT bit
-    rsym->setReserved(rsym->reserved() | ReservePLT);
+    rsym->reserve(ReservePLT);
+    Obj->requestPLT(rsym, /*IsIRelative=*/false);
     return;
   }
 
   case llvm::ELF::R_AARCH64_ADR_PREL_PG_HI21:
   case R_AARCH64_ADR_PREL_PG_HI21_NC: {
-    std::lock_guard<std::mutex> relocGuard(m_RelocMutex);
     if (getTarget().symbolNeedsDynRel(*rsym, (rsym->reserved() & ReservePLT),
                                       false)) {
       if (getTarget().symbolNeedsCopyReloc(pReloc, *rsym)) {
@@ -419,78 +360,79 @@ void AArch64Relocator::scanGlobalReloc(InputFile &pInput, Relocation &pReloc,
     bool isSymbolPreemptible = m_Target.isSymbolPreemptible(*rsym);
     if (isSymbolPreemptible) {
       // create plt for this symbol if it does not have one
-      if ((rsym->type() == ResolveInfo::Function) &&
-          !(rsym->reserved() & ReservePLT)) {
-        // Symbol needs PLT entry, we need a PLT entry
-        // and the corresponding GOT and dynamic relocation entry
-        // in .got and .rel.plt.
-        m_Target.createPLT(Obj, rsym);
-        // set PLT bit
-        rsym->setReserved(rsym->reserved() | ReservePLT);
+      // Symbol needs PLT entry, we need a PLT entry
+      // and the corresponding GOT and dynamic relocation entry
+      // in .got and .rel.plt.
+      if (rsym->type() == ResolveInfo::Function) {
+        rsym->reserve(ReservePLT);
+        Obj->requestPLT(rsym, /*IsIRelative=*/false);
       }
     }
     return;
   }
 
   case llvm::ELF::R_AARCH64_ADR_GOT_PAGE:
-  case llvm::ELF::R_AARCH64_LD64_GOT_LO12_NC: {
-    std::lock_guard<std::mutex> relocGuard(m_RelocMutex);
-    // Symbol needs GOT entry, reserve entry in .got
-    // return if we already create GOT for this symbol
-    if (rsym->reserved() & ReserveGOT)
-      return;
-    // if the symbol cannot be fully resolved at link time, then we need a
-    // dynamic relocation
-    CreateGOT(Obj, pReloc, !config().isCodeStatic(), m_Target,
-              config().codeGenType() == LinkerConfig::Exec);
-    // set GOT bit
-    rsym->setReserved(rsym->reserved() | ReserveGOT);
+  case llvm::ELF::R_AARCH64_LD64_GOT_LO12_NC:
+  case llvm::ELF::R_AARCH64_TLSIE_ADR_GOTTPREL_PAGE21:
+  case llvm::ELF::R_AARCH64_TLSIE_LD64_GOTTPREL_LO12_NC:
+  case llvm::ELF::R_AARCH64_TLSDESC_ADR_PAGE21:
+  case llvm::ELF::R_AARCH64_TLSDESC_LD64_LO12:
+  case llvm::ELF::R_AARCH64_TLSDESC_ADD_LO12:
+    // Symbol needs GOT entry, created by createRequestedGOT
+    Obj->requestGOT(&pReloc, pReloc.type());
     return;
+
+  default:
+    break;
   }
+}
+
+void AArch64Relocator::createRequestedGOT(ELFObjectFile &Obj,
+                                          Relocation &pReloc,
+                                          Relocation::Type Type) {
+  ResolveInfo *rsym = pReloc.symInfo();
+  // return if we already create GOT for this symbol
+  if (!rsym->reserve(ReserveGOT))
+    return;
+
+  switch (Type) {
+  case llvm::ELF::R_AARCH64_ADR_GOT_PAGE:
+  case llvm::ELF::R_AARCH64_LD64_GOT_LO12_NC:
+    // If building PIC object, a dynamic relocation with type RELATIVE is
+    // needed to relocate the GOT entry of a local symbol. A global symbol
+    // needs a dynamic relocation if it cannot be fully resolved at link time.
+    CreateGOT(&Obj, pReloc,
+              rsym->isLocal() ? config().isCodeIndep()
+                              : !config().isCodeStatic(),
+              m_Target, config().codeGenType() == LinkerConfig::Exec);
+    return;
 
   case llvm::ELF::R_AARCH64_TLSIE_ADR_GOTTPREL_PAGE21:
   case llvm::ELF::R_AARCH64_TLSIE_LD64_GOTTPREL_LO12_NC: {
-    std::lock_guard<std::mutex> relocGuard(m_RelocMutex);
-    // Symbol needs GOT entry, reserve entry in .got
-    // return if we already create GOT for this symbol
-    if (rsym->reserved() & ReserveGOT)
-      return;
-
     // set up the got and the corresponding rel entry
-    AArch64GOT *G = m_Target.createGOT(GOT::TLS_IE, Obj, rsym);
+    AArch64GOT *G = m_Target.createGOT(GOT::TLS_IE, &Obj, rsym);
     if (config().isCodeStatic()) {
-      rsym->setReserved(rsym->reserved() | ReserveGOT);
       G->setValueType(GOT::TLSStaticSymbolValue);
       return;
     }
-    helper_DynRel_init(Obj, &pReloc, rsym, G, 0x0,
-                       llvm::ELF::R_AARCH64_TLS_TPREL64, m_Target);
-    rsym->setReserved(rsym->reserved() | ReserveGOT);
+    helper_DynRel_init(&Obj, &pReloc, rsym, G, 0x0,
+                       llvm::ELF::R_AARCH64_TLS_TPREL64);
     return;
   }
 
   case llvm::ELF::R_AARCH64_TLSDESC_ADR_PAGE21:
   case llvm::ELF::R_AARCH64_TLSDESC_LD64_LO12:
   case llvm::ELF::R_AARCH64_TLSDESC_ADD_LO12: {
-    std::lock_guard<std::mutex> relocGuard(m_RelocMutex);
-
-    // Symbol needs GOT entry, reserve entry in .got
-    // return if we already create GOT for this symbol
-    if (rsym->reserved() & ReserveGOT)
-      return;
-
     if (config().isCodeStatic()) {
-      AArch64GOT *G = m_Target.createGOT(GOT::TLS_IE, Obj, rsym);
-      rsym->setReserved(rsym->reserved() | ReserveGOT);
+      AArch64GOT *G = m_Target.createGOT(GOT::TLS_IE, &Obj, rsym);
       G->setValueType(GOT::TLSStaticSymbolValue);
       return;
     }
-    AArch64GOT *G = m_Target.createGOT(GOT::TLS_DESC, Obj, rsym);
-    helper_DynRel_init(Obj, &pReloc, rsym, G->getFirst(), 0x0,
-                       llvm::ELF::R_AARCH64_TLSDESC, m_Target);
-    rsym->setReserved(rsym->reserved() | ReserveGOT);
+    AArch64GOT *G = m_Target.createGOT(GOT::TLS_DESC, &Obj, rsym);
+    helper_DynRel_init(&Obj, &pReloc, rsym, G->getFirst(), 0x0,
+                       llvm::ELF::R_AARCH64_TLSDESC);
     return;
-  };
+  }
 
   default:
     break;
@@ -75,6 +75,12 @@ public:
   void partialScanRelocation(Relocation &pReloc,
                              const ELFSection &pSection) override;
 
+  /// createRequestedGOT - create the GOT entries and dynamic relocations that
+  /// the relocation pReloc, scanned as Type, requested on Obj. Called in input
+  /// order once all relocations have been scanned.
+  void createRequestedGOT(ELFObjectFile &Obj, Relocation &pReloc,
+                          Relocation::Type Type);
+
 private:
   bool isInvalidReloc(Relocation &pType) const;
   void scanLocalReloc(InputFile &pInput, Relocation &pReloc,
@@ -26,7 +26,7 @@ ARMGOTPLT0 *ARMGOTPLT0::Create(ELFSection *O, ResolveInfo *R) {
   // Create a relocation and point to the ResolveInfo.
   Relocation *r1 = nullptr;
 
-  r1 = Relocation::Create(llvm::ELF::R_ARM_ABS32, 32, make<FragmentRef>(*G, 0),
+  r1 = Relocation::Create(llvm::ELF::R_ARM_ABS32, 32, FragmentRef(*G, 0),
                           0);
   r1->setSymInfo(R);
 
@@ -44,7 +44,7 @@ ARMGOTPLTN *ARMGOTPLTN::Create(ELFSection *O, ResolveInfo *R, Fragment *PLT) {
     // Fill GOT PLT slots with address of PLT0.
     FragmentRef *PLT0FragRef = make<FragmentRef>(*PLT, 0);
     Relocation *r0 = Relocation::Create(llvm::ELF::R_ARM_ABS32, 32,
-                                        make<FragmentRef>(*G, 0), 0);
+                                        FragmentRef(*G, 0), 0);
     O->addRelocation(r0);
     r0->modifyRelocationFragmentRef(PLT0FragRef);
   }
@@ -41,12 +41,14 @@
 #include "eld/Target/ELFSegmentFactory.h"
 #include "eld/Target/GNULDBackend.h"
 #include "eld/Target/TargetInfo.h"
+#include "llvm/ADT/DenseSet.h"
 #include "llvm/ADT/Twine.h"
 #include "llvm/BinaryFormat/ELF.h"
 #include "llvm/Object/ELFTypes.h"
 #include "llvm/Support/Casting.h"
 #include "llvm/Support/ErrorOr.h"
 #include "llvm/Support/FileSystem.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/Program.h"
 #include <cstring>
 
@@ -386,7 +388,7 @@ void ARMGNULDBackend::doPreLayout() {
         layoutInfo->recordFragment(Last->getInputFile(), Last, frag);
       // create the relocation against this entry
       entry_reloc = Relocation::Create(llvm::ELF::R_ARM_PREL31, 32,
-                                       make<FragmentRef>(*frag, 0), 0);
+                                       FragmentRef(*frag, 0), 0);
       entry_reloc->setSymInfo(entry_sym->resolveInfo());
       Last->addRelocation(entry_reloc);
       m_InternalRelocs.push_back(entry_reloc);
@@ -838,7 +840,75 @@ void ARMGNULDBackend::mayBeRelax(int, bool &pFinished) {
   ELFFileFormat *file_format = getOutputFormat();
   pFinished = true;
 
-  // check branch relocs and create the related stubs if needed
+  auto isBranchReloc = [](const Relocation *reloc) {
+    if (!reloc->symInfo())
+      return false;
+    // Undef weak call is converted to NOP, no need for any stubs
+    if (reloc->symInfo()->isWeak() && reloc->symInfo()->isUndef() &&
+        !reloc->symInfo()->isDyn() &&
+        !(reloc->symInfo()->reserved() & Relocator::ReservePLT))
+      return false;
+    switch (reloc->type()) {
+    case llvm::ELF::R_ARM_PC24:
+    case llvm::ELF::R_ARM_CALL:
+    case llvm::ELF::R_ARM_JUMP24:
+    case llvm::ELF::R_ARM_PLT32:
+    case llvm::ELF::R_ARM_THM_CALL:
+    case llvm::ELF::R_ARM_THM_JUMP24:
+    case llvm::ELF::R_ARM_THM_XPC22:
+    case llvm::ELF::R_ARM_THM_JUMP19:
+      return !reloc->symInfo()->isUndef() ||
+             (reloc->symInfo()->reserved() & Relocator::ReservePLT);
+    default:
+      return false;
+    }
+  };
+
+  // Find the branches that need a stub, one output section at a time. This
+  // only reads the layout, so output sections are scanned concurrently.
+  std::vector<OutputSectionEntry *> OutSections;
+  for (auto &O : OutputSectionToFrags) {
+    if (O.first)
+      OutSections.push_back(O.first);
+  }
+  std::vector<std::vector<Relocation *>> StubRelocs(OutSections.size());
+
+  auto ScanBranchesForOutputSection = [&](size_t n) {
+    OutputSectionEntry *Out = OutSections.at(n);
+    eld::RegisterTimer T(Out->name(), "Trampoline Time",
+                         m_Module.getConfig().options().printTimingStats());
+    ELFSection *LastSection = nullptr;
+    for (auto &F : OutputSectionToFrags.at(Out)) {
+      ELFSection *S = F->getOwningSection();
+      if (S == LastSection)
+        continue;
+      LastSection = S;
+      for (auto &reloc : S->getRelocations()) {
+        if (!isBranchReloc(reloc))
+          continue;
+        if (getStubFactory()->isStubNeeded(*reloc, m_Module, *this))
+          StubRelocs[n].push_back(reloc);
+      }
+    }
+  };
+
+  if (config().options().numThreads() <= 1 ||
+      !config().isLinkerRelaxationMultiThreaded()) {
+    for (size_t I = 0; I < OutSections.size(); ++I)
+      ScanBranchesForOutputSection(I);
+  } else {
+    llvm::parallelFor((size_t)0, OutSections.size(),
+                      ScanBranchesForOutputSection);
+  }
+
+  llvm::DenseSet<const Relocation *> NeedsStub;
+  for (auto &Relocs : StubRelocs)
+    NeedsStub.insert(Relocs.begin(), Relocs.end());
+  if (NeedsStub.empty())
+    return;
+
+  // Create the stubs in input order, so that stub names and placement do not
+  // depend on how output sections were scheduled.
   Module::obj_iterator input, inEnd = m_Module.objEnd();
   for (input = m_Module.objBegin(); input != inEnd; ++input) {
     ELFObjectFile *ObjFile = llvm::dyn_cast<ELFObjectFile>(*input);
@@ -848,52 +918,31 @@ void ARMGNULDBackend::mayBeRelax(int, bool &pFinished) {
       if (rs->isIgnore())
         continue;
       for (auto &reloc : rs->getLink()->getRelocations()) {
-        // Undef weak call is converted to NOP, no need for any stubs
-        if (reloc->symInfo()->isWeak() && reloc->symInfo()->isUndef() &&
-            !reloc->symInfo()->isDyn() &&
-            !(reloc->symInfo()->reserved() & Relocator::ReservePLT))
+        if (!NeedsStub.count(reloc))
           continue;
-
-        switch (reloc->type()) {
-        case llvm::ELF::R_ARM_PC24:
-        case llvm::ELF::R_ARM_CALL:
-        case llvm::ELF::R_ARM_JUMP24:
-        case llvm::ELF::R_ARM_PLT32:
-        case llvm::ELF::R_ARM_THM_CALL:
-        case llvm::ELF::R_ARM_THM_JUMP24:
-        case llvm::ELF::R_ARM_THM_XPC22:
-        case llvm::ELF::R_ARM_THM_JUMP19: {
-          Relocation *relocation = llvm::cast<Relocation>(reloc);
-          if (relocation->symInfo()->isUndef() &&
-              (relocation->symInfo()->reserved() & Relocator::ReservePLT) == 0)
-            continue;
-          std::pair<BranchIsland *, bool> branchIsland =
-              getStubFactory()->create(*relocation, // relocation
-                                       *m_Module.getIRBuilder(),
-                                       *getBRIslandFactory(), *this);
-          if (branchIsland.first && !branchIsland.second) {
-            switch (config().options().getStripSymbolMode()) {
-            case GeneralOptions::StripAllSymbols:
-            case GeneralOptions::StripLocals:
-              break;
-            default: {
-              // a stub symbol should be local
-              ELFSection &symtab = *file_format->getSymTab();
-              ELFSection &strtab = *file_format->getStrTab();
-
-              // increase the size of .symtab and .strtab if needed
-              symtab.setSize(symtab.size() + sizeof(llvm::ELF::Elf32_Sym));
-              symtab.setInfo(symtab.getInfo() + 1);
-              strtab.setSize(strtab.size() +
-                             branchIsland.first->symInfo()->nameSize() + 1);
-            }
-            } // end of switch
-            pFinished = false;
+        Relocation *relocation = llvm::cast<Relocation>(reloc);
+        std::pair<BranchIsland *, bool> branchIsland =
+            getStubFactory()->create(*relocation, // relocation
+                                     *m_Module.getIRBuilder(),
+                                     *getBRIslandFactory(), *this);
+        if (branchIsland.first && !branchIsland.second) {
+          switch (config().options().getStripSymbolMode()) {
+          case GeneralOptions::StripAllSymbols:
+          case GeneralOptions::StripLocals:
+            break;
+          default: {
+            // a stub symbol should be local
+            ELFSection &symtab = *file_format->getSymTab();
+            ELFSection &strtab = *file_format->getStrTab();
+
+            // increase the size of .symtab and .strtab if needed
+            symtab.setSize(symtab.size() + sizeof(llvm::ELF::Elf32_Sym));
+            symtab.setInfo(symtab.getInfo() + 1);
+            strtab.setSize(strtab.size() +
+                           branchIsland.first->symInfo()->nameSize() + 1);
           }
-        } break;
-
-        default:
-          break;
+          } // end of switch
+          pFinished = false;
         }
       }
     }
@@ -1140,7 +1189,7 @@ ARMPLT *ARMGNULDBackend::createPLT(ELFObjectFile *Obj, ResolveInfo *R,
   Relocation *rel_entry = Obj->getRelaPLT()->createOneReloc();
   rel_entry->setType(isIRelative ? llvm::ELF::R_ARM_IRELATIVE
                                  : llvm::ELF::R_ARM_JUMP_SLOT);
-  rel_entry->setTargetRef(make<FragmentRef>(*P->getGOT(), 0));
+  rel_entry->setTargetRef(FragmentRef(*P->getGOT(), 0));
   if (isIRelative)
     P->getGOT()->setValueType(GOT::SymbolValue);
   rel_entry->setSymInfo(R);
@@ -1160,6 +1209,22 @@ ARMPLT *ARMGNULDBackend::findEntryInPLT(ResolveInfo *I) const {
   return Entry->second;
 }
 
+void ARMGNULDBackend::mergeScannedEntries(ELFObjectFile &Obj) {
+  auto *R = static_cast<ARMRelocator *>(getRelocator());
+  for (const auto &G : Obj.getRequestedGOTs())
+    R->createRequestedGOT(Obj, *G.first, G.second);
+  for (const auto &P : Obj.getRequestedPLTs()) {
+    // An earlier file, or an earlier relocation of this file, may have
+    // requested the same entry.
+    if (findEntryInPLT(P.first))
+      continue;
+    createPLT(&Obj, P.first, P.second);
+    if (P.second)
+      defineIRelativeRange(*P.first);
+  }
+  GNULDBackend::mergeScannedEntries(Obj);
+}
+
 void ARMGNULDBackend::finishAssignOutputSections() {
   OutputSectionEntry *O = m_pRegionTableSection->getOutputSection();
 
@@ -1193,7 +1258,12 @@ void ARMGNULDBackend::finishAssignOutputSections() {
 bool ARMGNULDBackend::updateTargetSections() {
   if (!m_pRegionTableFragment)
     return false;
-  return m_pRegionTableFragment->updateInfo(this);
+  if (!m_pRegionTableFragment->updateInfo(this))
+    return false;
+  if (OutputSectionEntry *O =
+          m_pRegionTableFragment->getOwningSection()->getOutputSection())
+    O->setLayoutDirty();
+  return true;
 }
 
 bool ARMGNULDBackend::handleBSS(const ELFSection *prev,
@@ -1241,12 +1311,15 @@ bool ARMGNULDBackend::handleRelocation(ELFSection *Section,
   return false;
 }
 
+bool ARMGNULDBackend::mayHandleRelocations(const ELFSection *Section) const {
+  return llvm::isa_and_nonnull<ARMEXIDXSection>(Section);
+}
+
 void ARMGNULDBackend::setDefaultConfigs() {
   GNULDBackend::setDefaultConfigs();
   if (config().options().threadsEnabled() &&
       !config().isGlobalThreadingEnabled()) {
     config().disableThreadOptions(
-        LinkerConfig::EnableThreadsOpt::ScanRelocations |
         LinkerConfig::EnableThreadsOpt::ApplyRelocations |
         LinkerConfig::EnableThreadsOpt::LinkerRelaxation);
   }
@@ -141,6 +141,8 @@ public:
 
   ARMPLT *findEntryInPLT(ResolveInfo *) const;
 
+  void mergeScannedEntries(ELFObjectFile &Obj) override;
+
   int64_t getPLTAddr(ResolveInfo *pInfo) const override;
 
   bool hasSymInfo(const Relocation *X) const override {
@@ -239,6 +241,8 @@ public:
                         Relocation::Address Addend = 0,
                         bool LastVisit = false) override;
 
+  bool mayHandleRelocations(const ELFSection *Section) const override;
+
   std::size_t PLTEntriesCount() const override { return m_PLTMap.size(); }
 
   std::size_t GOTEntriesCount() const override { return m_GOTMap.size(); }
@@ -38,7 +38,7 @@ ARMPLT0 *ARMPLT0::Create(eld::IRBuilder &I, ARMGOT *G, ELFSection *O,
   // At Offset 16, Deposit the value of S + A - P (GOT0 - .)
   Relocation *r1 = nullptr;
   r1 = Relocation::Create(llvm::ELF::R_ARM_REL32, 32,
-                          make<FragmentRef>(*P, 0x10), 0x0);
+                          FragmentRef(*P, 0x10), 0x0);
   r1->setSymInfo(symbol->resolveInfo());
   O->addRelocation(r1);
   return P;
@@ -64,12 +64,12 @@ ARMPLTN *ARMPLTN::Create(eld::IRBuilder &I, ARMGOT *G, ELFSection *O,
   Relocation *r2 = nullptr;
   Relocation *r3 = nullptr;
   r1 =
-      Relocation::Create(R_ARM_ADD_PREL_20_8, 32, make<FragmentRef>(*P, 0), -8);
+      Relocation::Create(R_ARM_ADD_PREL_20_8, 32, FragmentRef(*P, 0), -8);
   r1->setSymInfo(symbol->resolveInfo());
   r2 =
-      Relocation::Create(R_ARM_ADD_PREL_12_8, 32, make<FragmentRef>(*P, 4), -4);
+      Relocation::Create(R_ARM_ADD_PREL_12_8, 32, FragmentRef(*P, 4), -4);
   r2->setSymInfo(symbol->resolveInfo());
-  r3 = Relocation::Create(R_ARM_LDR_PREL_12, 32, make<FragmentRef>(*P, 8), 0);
+  r3 = Relocation::Create(R_ARM_LDR_PREL_12, 32, FragmentRef(*P, 8), 0);
   r3->setSymInfo(symbol->resolveInfo());
   O->addRelocation(r1);
   O->addRelocation(r2);
@@ -67,11 +67,10 @@ static inline void helper_clear_thumb_bit(Relocator::Address &pValue) {
 // pReloc->symInfo()
 static Relocation *helper_DynRel_init(ELFObjectFile *Obj, Relocation *R,
                                       ResolveInfo *pSym, Fragment *F,
-                                      uint32_t pOffset, Relocator::Type pType,
-                                      ARMGNULDBackend &B) {
+                                      uint32_t pOffset, Relocator::Type pType) {
   Relocation *rel_entry = Obj->getRelaDyn()->createOneReloc();
   rel_entry->setType(pType);
-  rel_entry->setTargetRef(make<FragmentRef>(*F, pOffset));
+  rel_entry->setTargetRef(FragmentRef(*F, pOffset));
   rel_entry->setSymInfo(pSym);
   if (R)
     rel_entry->setAddend(R->addend());
@@ -83,7 +82,7 @@ static Relocation *helper_DynRel_init(ELFObjectFile *Obj, Relocation *R,
   // pointing to a merge string.
   if (R && (pType == llvm::ELF::R_ARM_RELATIVE ||
             pType == llvm::ELF::R_ARM_IRELATIVE)) {
-    B.recordRelativeReloc(rel_entry, R);
+    Obj->recordRelativeReloc(rel_entry, R);
   }
   return rel_entry;
 }
@@ -107,7 +106,7 @@ static ARMGOT *CreateGOT(ELFObjectFile *Obj, Relocation &pReloc, bool pHasRel,
 
   helper_DynRel_init(
       Obj, &pReloc, rsym, G, 0x0,
-      useRelative ? llvm::ELF::R_ARM_RELATIVE : llvm::ELF::R_ARM_GLOB_DAT, B);
+      useRelative ? llvm::ELF::R_ARM_RELATIVE : llvm::ELF::R_ARM_GLOB_DAT);
   if (useRelative)
     G->setValueType(GOT::SymbolValue);
   return G;
@@ -221,21 +220,19 @@ static bool helper_check_signed_overflow(Relocator::DWord pValue,
 }
 
 ARMGOT *ARMRelocator::getTLSModuleID(ResolveInfo *R, bool isStatic) {
-  static ARMGOT *G = nullptr;
-  if (G != nullptr) {
-    m_Target.recordGOT(R, G);
-    return G;
+  if (!m_TLSModuleID) {
+    m_TLSModuleID = m_Target.createGOT(GOT::TLS_LD, nullptr, nullptr);
+    if (isStatic) {
+      m_TLSModuleID->getFirst()->setReservedValue(1);
+      m_TLSModuleID->getFirst()->setValueType(GOT::TLSStaticSymbolValue);
+    } else {
+      helper_DynRel_init(m_Target.getDynamicSectionHeadersInputFile(), nullptr,
+                         nullptr, m_TLSModuleID, 0x0,
+                         llvm::ELF::R_ARM_TLS_DTPMOD32);
+    }
   }
-
-  G = m_Target.createGOT(GOT::TLS_LD, nullptr, nullptr);
-
-  if (!isStatic)
-    helper_DynRel_init(m_Target.getDynamicSectionHeadersInputFile(), nullptr,
-                       nullptr, G, 0x0, llvm::ELF::R_ARM_TLS_DTPMOD32,
-                       m_Target);
-
-  m_Target.recordGOT(R, G);
-  return G;
+  m_Target.recordGOT(R, m_TLSModuleID);
+  return m_TLSModuleID;
 }
 
 //===--------------------------------------------------------------------===//
@@ -374,11 +371,10 @@ void ARMRelocator::scanLocalReloc(InputFile &pInput, Relocation::Type Type,
     // a dynamic relocations with RELATIVE type to this location is needed.
     // Reserve an entry in .rel.dyn
     if (config().isCodeIndep()) {
-      std::lock_guard<std::mutex> relocGuard(m_RelocMutex);
       helper_DynRel_init(Obj, &pReloc, rsym, pReloc.targetRef()->frag(),
                          pReloc.targetRef()->offset(),
-                         llvm::ELF::R_ARM_RELATIVE, m_Target);
-      rsym->setReserved(rsym->reserved() | ReserveRel);
+                         llvm::ELF::R_ARM_RELATIVE);
+      rsym->reserve(ReserveRel);
       getTarget().checkAndSetHasTextRel(pSection);
     }
     return;
@@ -395,7 +391,6 @@ void ARMRelocator::scanLocalReloc(InputFile &pInput, Relocation::Type Type,
   case llvm::ELF::R_ARM_THM_MOVT_ABS: {
     // PIC code should not contain these kinds of relocation
     if (config().isCodeIndep()) {
-      std::lock_guard<std::mutex> relocGuard(m_RelocMutex);
       config().raise(Diag::non_pic_relocation)
           << (int)pReloc.type() << pReloc.symInfo()->name()
           << pReloc.getSourcePath(config().options());
@@ -410,15 +405,9 @@ void ARMRelocator::scanLocalReloc(InputFile &pInput, Relocation::Type Type,
 
   case llvm::ELF::R_ARM_GOT_BREL:
   case llvm::ELF::R_ARM_GOT_PREL: {
-    std::lock_guard<std::mutex> relocGuard(m_RelocMutex);
-    // A GOT entry is needed for these relocation type.
-    // return if we already create GOT for this symbol
-    if (rsym->reserved() & ReserveGOT)
-      return;
-    CreateGOT(Obj, pReloc, false, m_Target,
-              (config().codeGenType() == LinkerConfig::Exec));
-    // set GOT bit
-    rsym->setReserved(rsym->reserved() | ReserveGOT);
+    // A GOT entry is needed for these relocation type, created by
+    // createRequestedGOT.
+    Obj->requestGOT(&pReloc, Type);
     return;
   }
 
@@ -441,68 +430,13 @@ void ARMRelocator::scanLocalReloc(InputFile &pInput, Relocation::Type Type,
     return;
   }
 
-  case llvm::ELF::R_ARM_TLS_GD32: {
-    std::lock_guard<std::mutex> relocGuard(m_RelocMutex);
-    if (rsym->outSymbol()->type() != llvm::ELF::STT_TLS)
-      config().raise(Diag::tls_non_tls_mix)
-          << (int)pReloc.type() << pReloc.symInfo()->name();
-    if (rsym->reserved() & ReserveGOT)
-      return;
-
-    // set up a pair of got entries and a pair of dyn rel
-    ARMGOT *G = m_Target.createGOT(GOT::TLS_GD, Obj, rsym);
-    if (config().isCodeStatic()) {
-      rsym->setReserved(rsym->reserved() | ReserveGOT);
-      G->getFirst()->setReservedValue(1);
-      G->getFirst()->setValueType(GOT::TLSStaticSymbolValue);
-      G->getNext()->setValueType(GOT::TLSStaticSymbolValue);
-      return;
-    }
-    // setup dyn rel for got entries against rsym
-    helper_DynRel_init(Obj, &pReloc, rsym, G->getFirst(), 0x0,
-                       llvm::ELF::R_ARM_TLS_DTPMOD32, m_Target);
-    helper_DynRel_init(Obj, &pReloc, rsym, G->getNext(), 0x0,
-                       llvm::ELF::R_ARM_TLS_DTPOFF32, m_Target);
-
-    // set GOT bit
-    rsym->setReserved(rsym->reserved() | ReserveGOT);
-    return;
-  }
-
-  case llvm::ELF::R_ARM_TLS_LDM32: {
-    std::lock_guard<std::mutex> relocGuard(m_RelocMutex);
-    if (rsym->outSymbol()->type() != llvm::ELF::STT_TLS)
-      config().raise(Diag::tls_non_tls_mix)
-          << (int)pReloc.type() << pReloc.symInfo()->name();
-    ARMGOT *G = getTLSModuleID(pReloc.symInfo(), config().isCodeStatic());
-    if (config().isCodeStatic()) {
-      G->getFirst()->setReservedValue(1);
-      G->getFirst()->setValueType(GOT::TLSStaticSymbolValue);
-      rsym->setReserved(rsym->reserved() | ReserveGOT);
-      return;
-    }
-    return;
-  }
-
+  case llvm::ELF::R_ARM_TLS_GD32:
+  case llvm::ELF::R_ARM_TLS_LDM32:
   case llvm::ELF::R_ARM_TLS_IE32: {
-    std::lock_guard<std::mutex> relocGuard(m_RelocMutex);
     if (rsym->outSymbol()->type() != llvm::ELF::STT_TLS)
       config().raise(Diag::tls_non_tls_mix)
           << (int)pReloc.type() << pReloc.symInfo()->name();
-    if (rsym->reserved() & ReserveGOT)
-      return;
-
-    // set up the got and the corresponding rel entry
-    ARMGOT *G = m_Target.createGOT(GOT::TLS_IE, Obj, rsym);
-    if (config().isCodeStatic()) {
-      rsym->setReserved(rsym->reserved() | ReserveGOT);
-      G->setValueType(GOT::TLSStaticSymbolValue);
-      return;
-    }
-    helper_DynRel_init(Obj, &pReloc, rsym, G, 0x0, llvm::ELF::R_ARM_TLS_TPOFF32,
-                       m_Target);
-    if (rsym->reserved() == Relocator::None)
-      rsym->setReserved(rsym->reserved() | ReserveGOT);
+    Obj->requestGOT(&pReloc, Type);
     return;
   }
 
@@ -539,20 +473,16 @@ void ARMRelocator::scanGlobalReloc(InputFile &pInput, Relocation::Type Type,
   case llvm::ELF::R_ARM_THM_MOVW_ABS_NC:
   case llvm::ELF::R_ARM_THM_MOVT_ABS:
   case llvm::ELF::R_ARM_ABS32_NOI: {
-    std::lock_guard<std::mutex> relocGuard(m_RelocMutex);
     bool isSymbolPreemptible = m_Target.isSymbolPreemptible(*rsym);
     // Absolute relocation type, symbol may needs PLT entry or
     // dynamic relocation entry
     if (isSymbolPreemptible && (rsym->type() == ResolveInfo::Function)) {
       // create plt for this symbol if it does not have one
-      if (!(rsym->reserved() & ReservePLT)) {
-        // Symbol needs PLT entry, we need to reserve a PLT entry
-        // and the corresponding GOT and dynamic relocation entry
-        // in .got and .rel.plt.
-        m_Target.createPLT(Obj, rsym);
-        // set PLT bit
-        rsym->setReserved(rsym->reserved() | ReservePLT);
-      }
+      // Symbol needs PLT entry, we need to reserve a PLT entry
+      // and the corresponding GOT and dynamic relocation entry
+      // in .got and .rel.plt.
+      rsym->reserve(ReservePLT);
+      Obj->requestPLT(rsym, /*IsIRelative=*/false);
     }
 
     if (getTarget().symbolNeedsDynRel(*rsym, (rsym->reserved() & ReservePLT),
@@ -577,9 +507,8 @@ void ARMRelocator::scanGlobalReloc(InputFile &pInput, Relocation::Type Type,
         helper_DynRel_init(Obj, &pReloc, rsym, pReloc.targetRef()->frag(),
                            pReloc.targetRef()->offset(),
                            isSymbolPreemptible ? llvm::ELF::R_ARM_ABS32
-                                               : llvm::ELF::R_ARM_RELATIVE,
-                           m_Target);
-        rsym->setReserved(rsym->reserved() | ReserveRel);
+                                               : llvm::ELF::R_ARM_RELATIVE);
+        rsym->reserve(ReserveRel);
         getTarget().checkAndSetHasTextRel(pSection);
       }
     }
@@ -646,7 +575,6 @@ void ARMRelocator::scanGlobalReloc(InputFile &pInput, Relocation::Type Type,
   case llvm::ELF::R_ARM_MOVW_BREL_NC:
   case llvm::ELF::R_ARM_MOVT_BREL:
   case llvm::ELF::R_ARM_MOVW_BREL: {
-    std::lock_guard<std::mutex> relocGuard(m_RelocMutex);
     // Relative addressing relocation, may needs dynamic relocation
 
     if (getTarget().symbolNeedsDynRel(*rsym, (rsym->reserved() & ReservePLT),
@@ -662,7 +590,7 @@ void ARMRelocator::scanGlobalReloc(InputFile &pInput, Relocation::Type Type,
           m_Target.getModule().setFailure(true);
           return;
         }
-        rsym->setReserved(rsym->reserved() | ReserveRel);
+        rsym->reserve(ReserveRel);
         getTarget().checkAndSetHasTextRel(pSection);
       }
     }
@@ -681,21 +609,14 @@ void ARMRelocator::scanGlobalReloc(InputFile &pInput, Relocation::Type Type,
   case llvm::ELF::R_ARM_THM_JUMP6:
   case llvm::ELF::R_ARM_THM_JUMP11:
   case llvm::ELF::R_ARM_THM_JUMP8: {
-    std::lock_guard<std::mutex> relocGuard(m_RelocMutex);
     // These are branch relocation (except PREL31)
     // A PLT entry is needed when building shared library
 
-    // return if we already create plt for this symbol
-    if (rsym->reserved() & ReservePLT)
-      return;
-
     // create IRELATIVE for IFUNC symbol
     if ((rsym->type() == ResolveInfo::IndirectFunc) &&
         (config().isCodeStatic())) {
-      m_Target.createPLT(Obj, rsym, true);
-      rsym->setReserved(rsym->reserved() | ReservePLT);
-      ARMGNULDBackend &backend = getTarget();
-      backend.defineIRelativeRange(*rsym);
+      rsym->reserve(ReservePLT);
+      Obj->requestPLT(rsym, /*IsIRelative=*/true);
       return;
     }
 
@@ -710,26 +631,16 @@ void ARMRelocator::scanGlobalReloc(InputFile &pInput, Relocation::Type Type,
     // Symbol needs PLT entry, we need to reserve a PLT entry
     // and the corresponding GOT and dynamic relocation entry
     // in .got and .rel.plt.
-    m_Target.createPLT(Obj, rsym);
-    // set PLT bit
-    rsym->setReserved(rsym->reserved() | ReservePLT);
+    rsym->reserve(ReservePLT);
+    Obj->requestPLT(rsym, /*IsIRelative=*/false);
     return;
   }
 
   case llvm::ELF::R_ARM_GOT_BREL:
   case llvm::ELF::R_ARM_GOT_ABS:
   case llvm::ELF::R_ARM_GOT_PREL: {
-    std::lock_guard<std::mutex> relocGuard(m_RelocMutex);
-    // Symbol needs GOT entry, reserve entry in .got
-    // return if we already create GOT for this symbol
-    if (rsym->reserved() & ReserveGOT)
-      return;
-    // if the symbol cannot be fully resolved at link time, then we need a
-    // dynamic relocation
-    CreateGOT(Obj, pReloc, !config().isCodeStatic(), m_Target,
-              config().codeGenType() == LinkerConfig::Exec);
-    // set GOT bit
-    rsym->setReserved(rsym->reserved() | ReserveGOT);
+    // Symbol needs GOT entry, created by createRequestedGOT
+    Obj->requestGOT(&pReloc, Type);
     return;
   }
 
@@ -744,74 +655,81 @@ void ARMRelocator::scanGlobalReloc(InputFile &pInput, Relocation::Type Type,
     return;
   }
 
-  case llvm::ELF::R_ARM_TLS_GD32: {
-    std::lock_guard<std::mutex> relocGuard(m_RelocMutex);
+  case llvm::ELF::R_ARM_TLS_GD32:
+  case llvm::ELF::R_ARM_TLS_LDM32:
+  case llvm::ELF::R_ARM_TLS_IE32: {
     if (rsym->outSymbol()->type() != llvm::ELF::STT_TLS)
       config().raise(Diag::tls_non_tls_mix)
           << (int)pReloc.type() << pReloc.symInfo()->name();
-    if (rsym->reserved() & ReserveGOT)
-      return;
+    Obj->requestGOT(&pReloc, Type);
+    return;
+  }
 
-    // set up a pair of got entries and a pair of dyn rel
-    ARMGOT *G = m_Target.createGOT(GOT::TLS_GD, Obj, rsym);
+  default: {
+    break;
+  }
+  } // end switch
+}
 
-    if (config().isCodeStatic()) {
-      rsym->setReserved(rsym->reserved() | ReserveGOT);
-      G->getFirst()->setReservedValue(1);
-      G->getFirst()->setValueType(GOT::TLSStaticSymbolValue);
-      G->getNext()->setValueType(GOT::TLSStaticSymbolValue);
-      return;
-    }
-    // setup dyn rel for got entries against rsym
-    helper_DynRel_init(Obj, &pReloc, rsym, G->getFirst(), 0x0,
-                       llvm::ELF::R_ARM_TLS_DTPMOD32, m_Target);
-    helper_DynRel_init(Obj, &pReloc, rsym, G->getNext(), 0x0,
-                       llvm::ELF::R_ARM_TLS_DTPOFF32, m_Target);
+void ARMRelocator::createRequestedGOT(ELFObjectFile &Obj, Relocation &pReloc,
+                                      Relocation::Type Type) {
+  // rsym - The relocation target symbol
+  ResolveInfo *rsym = pReloc.symInfo();
 
-    // set GOT bit
-    rsym->setReserved(rsym->reserved() | ReserveGOT);
+  // All local dynamic TLS relocations share the module ID entry.
+  if (Type == llvm::ELF::R_ARM_TLS_LDM32) {
+    getTLSModuleID(rsym, config().isCodeStatic());
+    if (config().isCodeStatic())
+      rsym->reserve(ReserveGOT);
     return;
-  } break;
+  }
 
-  case llvm::ELF::R_ARM_TLS_LDM32: {
-    std::lock_guard<std::mutex> relocGuard(m_RelocMutex);
-    if (rsym->outSymbol()->type() != llvm::ELF::STT_TLS)
-      config().raise(Diag::tls_non_tls_mix)
-          << (int)pReloc.type() << pReloc.symInfo()->name();
-    ARMGOT *G = getTLSModuleID(pReloc.symInfo(), config().isCodeStatic());
+  // return if we already create GOT for this symbol
+  if (!rsym->reserve(ReserveGOT))
+    return;
+
+  switch (Type) {
+  case llvm::ELF::R_ARM_GOT_BREL:
+  case llvm::ELF::R_ARM_GOT_ABS:
+  case llvm::ELF::R_ARM_GOT_PREL:
+    // The GOT entry of a global symbol needs a dynamic relocation if the
+    // symbol cannot be fully resolved at link time.
+    CreateGOT(&Obj, pReloc, !rsym->isLocal() && !config().isCodeStatic(),
+              m_Target, config().codeGenType() == LinkerConfig::Exec);
+    return;
+
+  case llvm::ELF::R_ARM_TLS_GD32: {
+    // set up a pair of got entries and a pair of dyn rel
+    ARMGOT *G = m_Target.createGOT(GOT::TLS_GD, &Obj, rsym);
     if (config().isCodeStatic()) {
       G->getFirst()->setReservedValue(1);
       G->getFirst()->setValueType(GOT::TLSStaticSymbolValue);
-      rsym->setReserved(rsym->reserved() | ReserveGOT);
+      G->getNext()->setValueType(GOT::TLSStaticSymbolValue);
       return;
     }
+    // setup dyn rel for got entries against rsym
+    helper_DynRel_init(&Obj, &pReloc, rsym, G->getFirst(), 0x0,
+                       llvm::ELF::R_ARM_TLS_DTPMOD32);
+    helper_DynRel_init(&Obj, &pReloc, rsym, G->getNext(), 0x0,
+                       llvm::ELF::R_ARM_TLS_DTPOFF32);
     return;
   }
 
   case llvm::ELF::R_ARM_TLS_IE32: {
-    std::lock_guard<std::mutex> relocGuard(m_RelocMutex);
-    if (rsym->outSymbol()->type() != llvm::ELF::STT_TLS)
-      config().raise(Diag::tls_non_tls_mix)
-          << (int)pReloc.type() << pReloc.symInfo()->name();
-    if (rsym->reserved() & ReserveGOT)
-      return;
-
     // set up the got and the corresponding rel entry
-    ARMGOT *G = m_Target.createGOT(GOT::TLS_IE, Obj, rsym);
+    ARMGOT *G = m_Target.createGOT(GOT::TLS_IE, &Obj, rsym);
     if (config().isCodeStatic()) {
-      rsym->setReserved(rsym->reserved() | ReserveGOT);
       G->setValueType(GOT::TLSStaticSymbolValue);
       return;
     }
-    helper_DynRel_init(Obj, &pReloc, rsym, G, 0x0, llvm::ELF::R_ARM_TLS_TPOFF32,
-                       m_Target);
-    rsym->setReserved(rsym->reserved() | ReserveGOT);
+    helper_DynRel_init(&Obj, &pReloc, rsym, G, 0x0,
+                       llvm::ELF::R_ARM_TLS_TPOFF32);
     return;
   }
-  default: {
+
+  default:
     break;
   }
-  } // end switch
 }
 
 void ARMRelocator::scanRelocation(Relocation &pReloc, eld::IRBuilder &pBuilder,
@@ -60,6 +60,12 @@ public:
                       ELFSection &pSection, InputFile &pInputFile,
                       CopyRelocs &) override;
 
+  /// createRequestedGOT - create the GOT entries and dynamic relocations that
+  /// the relocation pReloc, scanned as Type, requested on Obj. Called in input
+  /// order once all relocations have been scanned.
+  void createRequestedGOT(ELFObjectFile &Obj, Relocation &pReloc,
+                          Relocation::Type Type);
+
   ELFSegment *getSBRELSegment() const { return m_Target.getSBRELSegment(); }
 
   void setSBRELSegment(ELFSegment *S) { m_Target.setSBRELSegment(S); }
@@ -83,6 +89,9 @@ private:
 
 private:
   ARMGNULDBackend &m_Target;
+  /// The GOT entry for the module ID, shared by all local dynamic TLS
+  /// relocations.
+  ARMGOT *m_TLSModuleID = nullptr;
 };
 
 } // namespace eld
@@ -1898,6 +1898,40 @@ static void checkFragOffset(const Fragment *F, DiagnosticEngine *DiagEngine) {
   }
 }
 
+bool GNULDBackend::reuseOutputSectionLayout(OutputSectionEntry *out) {
+  if (!m_IncrementalLayout || out->isLayoutDirty())
+    return false;
+  if (IsSectionTracingRequested || m_Module.getPrinter()->traceAssignments())
+    return false;
+  auto Layout = m_OutputSectionLayouts.find(out);
+  if (Layout == m_OutputSectionLayouts.end() || !Layout->second.CanReuse)
+    return false;
+
+  ELFSection *OutSection = out->getSection();
+  // Fragment offsets are relative to the output section, so a section that
+  // moved only needs the addresses of its input sections updated.
+  if (OutSection->addr() != Layout->second.Addr ||
+      OutSection->pAddr() != Layout->second.PAddr) {
+    for (Fragment *F : OutputSectionToFrags[out]) {
+      if (F->isNull())
+        continue;
+      F->getOwningSection()->setOffsetAndAddr(
+          F->getOffset(config().getDiagEngine()));
+    }
+    Layout->second.Addr = OutSection->addr();
+    Layout->second.PAddr = OutSection->pAddr();
+  }
+
+  LDSymbol *dotSymbol = m_Module.getDotSymbol();
+  if (!OutSection->isAlloc())
+    dotSymbol->setValue(OutSection->addr());
+  else if (OutSection->isTBSS())
+    dotSymbol->setValue(OutSection->addr());
+  else
+    dotSymbol->setValue(OutSection->addr() + OutSection->size());
+  return true;
+}
+
 // Study this function! Use this function to emit diagnostics of
 // getOffset(config().getDiagEngine()).
 void GNULDBackend::evaluateAssignments(OutputSectionEntry *out,
@@ -1906,6 +1940,11 @@ void GNULDBackend::evaluateAssignments(OutputSectionEntry *out,
   eld::RegisterTimer T("Evaluate Expressions", "Establish Layout",
                        m_Module.getConfig().options().printTimingStats());
 
+  ++m_NumSectionsLaidOut;
+  if (reuseOutputSectionLayout(out))
+    return;
+  ++m_NumSectionsRecomputed;
+
   ELFSection *OutSection = out->getSection();
 
   LDSymbol *dotSymbol = m_Module.getDotSymbol();
@@ -1934,6 +1973,10 @@ void GNULDBackend::evaluateAssignments(OutputSectionEntry *out,
 
   bool hasAssignmentsOrFragments = false;
 
+  // The layout can be reused as long as the offsets below depend only on
+  // fragment sizes and alignments.
+  bool CanReuseLayout = !fillExpression && m_Module.getAtTable().empty();
+
   // Create empty entry
   if (OutputSectionToFrags.find(out) == OutputSectionToFrags.end())
     OutputSectionToFrags[out];
@@ -1946,6 +1989,8 @@ void GNULDBackend::evaluateAssignments(OutputSectionEntry *out,
 
     RuleContainer *CurRule = (*in);
     ELFSection *InSection = CurRule->getSection();
+    if (CurRule->hasAssignments())
+      CanReuseLayout = false;
     // Evaluate all assignments at the beginning of input section.
     for (RuleContainer::sym_iterator it = (*in)->symBegin(),
                                      ie = (*in)->symEnd();
@@ -2028,6 +2073,9 @@ void GNULDBackend::evaluateAssignments(OutputSectionEntry *out,
       auto OwningSection = F->getOwningSection();
       if (OwningSection->isFixedAddr())
         offset = offset + (OwningSection->addr() - dotSymbol->value());
+      if (OwningSection->isFixedAddr() || OwningSection == m_ehdr ||
+          OwningSection == m_phdr)
+        CanReuseLayout = false;
       hasAssignmentsOrFragments = true;
       F->setOffset(offset);
       checkFragOffset(F, config().getDiagEngine());
@@ -2080,6 +2128,12 @@ void GNULDBackend::evaluateAssignments(OutputSectionEntry *out,
   if (!OutSection->isAlloc())
     dotSymbol->setValue(InitialDotValue);
 
+  OutputSectionLayout &Layout = m_OutputSectionLayouts[out];
+  Layout.Addr = OutSection->addr();
+  Layout.PAddr = OutSection->pAddr();
+  Layout.CanReuse = CanReuseLayout;
+  out->setLayoutDirty(false);
+
   if (!(m_Module.getPrinter()->traceAssignments()))
     return;
 
@@ -3599,7 +3653,7 @@ GNULDBackend::postProcessing(llvm::FileOutputBuffer &pOutput) {
   fillValuesFromUser(pOutput);
 
   if (m_pEhFrameHdrFragment) {
-    eld::RegisterTimer T("EhFrameHdr Emit", "Post Processing",
+    eld::RegisterTimer T("Create .eh_frame_hdr", "Emit Output File",
                          m_Module.getConfig().options().printTimingStats());
     MemoryRegion region =
         getFileOutputRegion(pOutput, 0, pOutput.getBufferSize());
@@ -3857,6 +3911,12 @@ void GNULDBackend::checkAndSetHasTextRel(const ELFSection &pSection) {
   return;
 }
 
+void GNULDBackend::mergeScannedEntries(ELFObjectFile &Obj) {
+  for (const auto &R : Obj.getRelativeRelocs())
+    recordRelativeReloc(R.first, R.second);
+  Obj.clearScannedEntries();
+}
+
 /// sortRelocation - sort the dynamic relocations to let dynamic linker
 /// process relocations more efficiently
 void GNULDBackend::sortRelocation(ELFSection &pSection) {
@@ -3969,6 +4029,11 @@ bool GNULDBackend::relax() {
 
   while (!finished) {
     auto start = std::chrono::steady_clock::now();
+    // After the first iteration, only output sections whose fragments changed
+    // are laid out again; the others are moved as a whole.
+    m_IncrementalLayout = iteration > 0;
+    m_NumSectionsLaidOut = 0;
+    m_NumSectionsRecomputed = 0;
     {
       eld::RegisterTimer T("Assign Address", "Establish Layout",
                            m_Module.getConfig().options().printTimingStats());
@@ -3982,6 +4047,8 @@ bool GNULDBackend::relax() {
       }
     }
 
+    m_IncrementalLayout = false;
+
     if (!config().getDiagEngine()->diagnose()) {
       if (m_Module.getPrinter()->isVerbose())
         config().raise(Diag::function_has_error) << __PRETTY_FUNCTION__;
@@ -4003,7 +4070,8 @@ bool GNULDBackend::relax() {
       config().raise(Diag::layout_stats)
           << iteration
           << (int)std::chrono::duration<double, std::milli>(end - start)
-                 .count();
+                 .count()
+          << m_NumSectionsRecomputed << m_NumSectionsLaidOut;
     iteration++;
   }
 
@@ -20,7 +20,7 @@ HexagonGOTPLT0 *HexagonGOTPLT0::Create(ELFSection *O, ResolveInfo *R) {
   // Create a relocation and point to the ResolveInfo.
   Relocation *r1 = nullptr;
 
-  r1 = Relocation::Create(llvm::ELF::R_HEX_32, 32, make<FragmentRef>(*G, 0), 0);
+  r1 = Relocation::Create(llvm::ELF::R_HEX_32, 32, FragmentRef(*G, 0), 0);
   r1->setSymInfo(R);
 
   O->addRelocation(r1);
@@ -34,7 +34,7 @@ HexagonGOTPLTN *HexagonGOTPLTN::Create(ELFSection *O, ResolveInfo *R,
   if (PLT) {
     FragmentRef *PLTFragRef = make<FragmentRef>(*PLT, 0);
     Relocation *r3 = Relocation::Create(llvm::ELF::R_HEX_32, 32,
-                                        make<FragmentRef>(*G, 0), 0);
+                                        FragmentRef(*G, 0), 0);
     O->addRelocation(r3);
     r3->modifyRelocationFragmentRef(PLTFragRef);
   }
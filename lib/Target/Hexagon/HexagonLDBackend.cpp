@@ -1029,7 +1029,7 @@ HexagonPLT *HexagonLDBackend::createPLT(ELFObjectFile *Obj, ResolveInfo *R) {
   Relocation &rela_entry = *Obj->getRelaPLT()->createOneReloc();
   rela_entry.setType(llvm::ELF::R_HEX_JMP_SLOT);
   Fragment *F = P->getGOT();
-  rela_entry.setTargetRef(make<FragmentRef>(*F, 0));
+  rela_entry.setTargetRef(FragmentRef(*F, 0));
   rela_entry.setSymInfo(R);
   if (R)
     recordPLT(R, P);
@@ -33,10 +33,10 @@ HexagonPLT0 *HexagonPLT0::Create(eld::IRBuilder &I, HexagonGOT *G,
   symbol->setShouldIgnore(false);
 
   r1 = Relocation::Create(llvm::ELF::R_HEX_B32_PCREL_X, 32,
-                          make<FragmentRef>(*P, 0), 0);
+                          FragmentRef(*P, 0), 0);
   r1->setSymInfo(symbol->resolveInfo());
   r2 = Relocation::Create(llvm::ELF::R_HEX_6_PCREL_X, 32,
-                          make<FragmentRef>(*P, 4), 4);
+                          FragmentRef(*P, 4), 4);
   r2->setSymInfo(symbol->resolveInfo());
   O->addRelocation(r1);
   O->addRelocation(r2);
@@ -64,10 +64,10 @@ HexagonPLTN *HexagonPLTN::Create(eld::IRBuilder &I, HexagonGOT *G,
       true /* isPostLTOPhase */);
   symbol->setShouldIgnore(false);
   r1 = Relocation::Create(llvm::ELF::R_HEX_B32_PCREL_X, 32,
-                          make<FragmentRef>(*P, 0), 0);
+                          FragmentRef(*P, 0), 0);
   r1->setSymInfo(symbol->resolveInfo());
   r2 = Relocation::Create(llvm::ELF::R_HEX_6_PCREL_X, 32,
-                          make<FragmentRef>(*P, 4), 4);
+                          FragmentRef(*P, 4), 4);
   r2->setSymInfo(symbol->resolveInfo());
   O->addRelocation(r1);
   O->addRelocation(r2);
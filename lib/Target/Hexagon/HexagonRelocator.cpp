@@ -27,7 +27,7 @@ Relocation *helper_DynRel_init(ELFObjectFile *Obj, const Relocation *R,
                                Relocator::Type pType, HexagonLDBackend &B) {
   Relocation *rela_entry = Obj->getRelaDyn()->createOneReloc();
   rela_entry->setType(pType);
-  rela_entry->setTargetRef(make<FragmentRef>(*F, pOffset));
+  rela_entry->setTargetRef(FragmentRef(*F, pOffset));
   rela_entry->setSymInfo(pSym);
   if (R)
     rela_entry->setAddend(R->addend());
@@ -14,12 +14,13 @@
 #include "eld/Target/LDFileFormat.h"
 #include "eld/Config/LinkerConfig.h"
 #include "llvm/BinaryFormat/ELF.h"
+#include <algorithm>
 
 using namespace eld;
 
 LDFileFormat::Kind LDFileFormat::getELFSectionKind(
     uint32_t Flags, uint32_t AddrAlign, uint32_t EntSize, uint32_t Type,
-    llvm::StringRef Name, const LinkerConfig &Config) {
+    llvm::StringRef Name, const LinkerConfig &Config, bool Diagnose) {
 
   bool IsPartialLink = Config.isLinkPartial();
 
@@ -39,6 +40,17 @@ LDFileFormat::Kind LDFileFormat::getELFSectionKind(
   if (IsSectionMergeStrings && AddrAlign == 1 && EntSize == 1 && !IsPartialLink)
     return LDFileFormat::MergeStr;
 
+  // Allocatable sections of fixed-size constants, such as .rodata.cst8, are
+  // split into entries of EntSize bytes. Every entry must keep the alignment
+  // of the section.
+  bool IsSectionMergeConstants = (Flags & llvm::ELF::SHF_MERGE) &&
+                                 !(Flags & llvm::ELF::SHF_STRINGS) &&
+                                 (Flags & llvm::ELF::SHF_ALLOC) &&
+                                 Type != llvm::ELF::SHT_NOBITS;
+  if (IsSectionMergeConstants && EntSize > 1 &&
+      EntSize % std::max<uint32_t>(AddrAlign, 1) == 0 && !IsPartialLink)
+    return LDFileFormat::MergeStr;
+
   if (IsPartialLink && EntSize <= 1) {
     if (IsSectionMergeStrings && Name == ".comment")
       return LDFileFormat::MergeStr;
@@ -113,7 +125,8 @@ LDFileFormat::Kind LDFileFormat::getELFSectionKind(
         (Type >= llvm::ELF::SHT_LOOS && Type <= llvm::ELF::SHT_HIOS) ||
         (Type >= llvm::ELF::SHT_LOUSER && Type <= llvm::ELF::SHT_HIUSER))
       return LDFileFormat::Target;
-    Config.raise(Diag::err_unsupported_section) << Name << Type;
+    if (Diagnose)
+      Config.raise(Diag::err_unsupported_section) << Name << Type;
     return LDFileFormat::Error;
   }
   return LDFileFormat::MetaData;
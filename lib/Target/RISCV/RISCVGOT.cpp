@@ -27,10 +27,10 @@ RISCVGOT *RISCVGOT::CreateGOT0(ELFSection *O, ResolveInfo *R, bool is32bit) {
   // Create a relocation and point to the ResolveInfo.
   Relocation *r1 = nullptr;
   if (is32bit)
-    r1 = Relocation::Create(llvm::ELF::R_RISCV_32, 32, make<FragmentRef>(*G, 0),
+    r1 = Relocation::Create(llvm::ELF::R_RISCV_32, 32, FragmentRef(*G, 0),
                             0);
   else
-    r1 = Relocation::Create(llvm::ELF::R_RISCV_64, 64, make<FragmentRef>(*G, 0),
+    r1 = Relocation::Create(llvm::ELF::R_RISCV_64, 64, FragmentRef(*G, 0),
                             0);
   r1->setSymInfo(R);
   O->addRelocation(r1);
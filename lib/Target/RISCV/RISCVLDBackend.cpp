@@ -36,6 +36,8 @@
 #include "llvm/ADT/StringSwitch.h"
 #include "llvm/BinaryFormat/ELF.h"
 #include "llvm/Support/Casting.h"
+#include "llvm/Support/Parallel.h"
+#include <atomic>
 #include <optional>
 #include <string>
 
@@ -61,7 +63,9 @@ Relocator *RISCVLDBackend::getRelocator() const {
   return m_pRelocator;
 }
 
-Relocation::Address RISCVLDBackend::getSymbolValuePLT(Relocation &R) {
+Relocation::Address
+RISCVLDBackend::getSymbolValuePLT(Relocation &R,
+                                  const RegionFragmentEx *Region) {
   ResolveInfo *rsym = R.symInfo();
   if (rsym && (rsym->reserved() & Relocator::ReservePLT)) {
     if (const Fragment *S = findEntryInPLT(rsym))
@@ -69,7 +73,37 @@ Relocation::Address RISCVLDBackend::getSymbolValuePLT(Relocation &R) {
     if (const ResolveInfo *S = findAbsolutePLT(rsym))
       return S->value();
   }
-  return getRelocator()->getSymValue(&R);
+  Relocation::Address S = getRelocator()->getSymValue(&R);
+  if (!Region)
+    return S;
+  // Discount bytes already deleted before the symbol in this pass.
+  const FragmentRef *Ref = R.targetFragRef();
+  if (!Ref && rsym && rsym->outSymbol())
+    Ref = rsym->outSymbol()->fragRef();
+  if (const RegionFragmentEx *SymRegion = getRelaxedRegion(Ref, *Region))
+    S -= Ref->offset() - SymRegion->getRelaxedOffset(Ref->offset());
+  return S;
+}
+
+const RegionFragmentEx *
+RISCVLDBackend::getRelaxedRegion(const FragmentRef *Ref,
+                                 const RegionFragmentEx &Region) const {
+  if (!Ref || !Ref->frag())
+    return nullptr;
+  if (Ref->frag() == &Region)
+    return &Region;
+  // Sections relaxed concurrently only see their own deletions. Serially,
+  // sections relaxed earlier in the pass have their deletions seen too.
+  if (m_RelaxSectionsConcurrently)
+    return nullptr;
+  return llvm::dyn_cast<RegionFragmentEx>(Ref->frag());
+}
+
+Relocation::Address
+RISCVLDBackend::getRelaxedPlace(const Relocation &R,
+                                const RegionFragmentEx &Region) const {
+  FragmentRef::Offset Off = R.targetRef()->offset();
+  return R.place(m_Module) - (Off - Region.getRelaxedOffset(Off));
 }
 
 Relocation::Type RISCVLDBackend::getCopyRelType() const {
@@ -198,31 +232,48 @@ ELFSection *RISCVLDBackend::mergeSection(ELFSection *S) {
 
 void RISCVLDBackend::relaxDeleteBytes(StringRef Name, RegionFragmentEx &Region,
                                       uint64_t Offset, unsigned NumBytes,
-                                      StringRef SymbolName) {
+                                      StringRef SymbolName,
+                                      RISCVRelaxationStats &Stats) {
   auto &Section = *Region.getOwningSection();
-  Region.deleteInstruction(Offset, NumBytes);
+  // Bytes are only compacted at the end of the pass, so that offsets seen by
+  // the rest of the pass stay valid within the region.
+  Region.addPendingDeletion(Offset, NumBytes);
   if (m_Module.getPrinter()->isVerbose())
     config().raise(Diag::deleting_instructions)
         << Name << NumBytes << SymbolName << Section.name()
-        << llvm::utohexstr(Offset, true)
+        << llvm::utohexstr(Region.getRelaxedOffset(Offset), true)
         << Section.getInputFile()->getInput()->decoratedPath();
-  recordRelaxationStats(Section, NumBytes, 0);
+  Stats.addBytesDeleted(NumBytes);
+}
+
+size_t
+RISCVLDBackend::getRelaxedSymbolSize(const ResolveInfo *Info,
+                                     const RegionFragmentEx &Region) const {
+  const LDSymbol *Sym = Info->outSymbol();
+  const FragmentRef *Ref = Sym->fragRef();
+  const RegionFragmentEx *SymRegion = getRelaxedRegion(Ref, Region);
+  if (!SymRegion || Info->isSection())
+    return Sym->size();
+  return Sym->size() - SymRegion->getPendingDeletedBytes(
+                           Ref->offset(), Ref->offset() + Sym->size());
 }
 
 void RISCVLDBackend::reportMissedRelaxation(StringRef Name,
                                             RegionFragmentEx &Region,
                                             uint64_t Offset, unsigned NumBytes,
-                                            StringRef SymbolName) {
+                                            StringRef SymbolName,
+                                            RISCVRelaxationStats &Stats) {
   auto &Section = *Region.getOwningSection();
   if (m_Module.getPrinter()->isVerbose())
     config().raise(Diag::not_relaxed)
         << Name << NumBytes << SymbolName << Section.name()
-        << llvm::utohexstr(Offset, true)
+        << llvm::utohexstr(Region.getRelaxedOffset(Offset), true)
         << Section.getInputFile()->getInput()->decoratedPath();
-  recordRelaxationStats(Section, 0, NumBytes);
+  Stats.addBytesNotDeleted(NumBytes);
 }
 
-bool RISCVLDBackend::doRelaxationCall(Relocation *reloc, bool DoCompressed) {
+bool RISCVLDBackend::doRelaxationCall(Relocation *reloc, bool DoCompressed,
+                                      RISCVRelaxationStats &Stats) {
   Fragment *frag = reloc->targetRef()->frag();
   RegionFragmentEx *region = llvm::dyn_cast<RegionFragmentEx>(frag);
   if (!region)
@@ -241,15 +292,15 @@ bool RISCVLDBackend::doRelaxationCall(Relocation *reloc, bool DoCompressed) {
   bool canCompress = (rd == 0 || (rd == 1 && config().targets().is32Bits()));
 
   // test if it can fall into 21bits
-  Relocator::DWord S = getSymbolValuePLT(*reloc);
+  Relocator::DWord S = getSymbolValuePLT(*reloc, region);
   Relocator::DWord A = reloc->addend();
-  Relocator::DWord P = reloc->place(m_Module);
+  Relocator::DWord P = getRelaxedPlace(*reloc, *region);
   Relocator::DWord X = S + A - P;
   bool canRelax = config().options().getRISCVRelax() && llvm::isInt<21>(X);
 
   if (!canRelax) {
     reportMissedRelaxation("RISCV_CALL", *region, offset, canCompress ? 6 : 4,
-                           reloc->symInfo()->name());
+                           reloc->symInfo()->name(), Stats);
     return false;
   }
 
@@ -268,7 +319,8 @@ bool RISCVLDBackend::doRelaxationCall(Relocation *reloc, bool DoCompressed) {
             << llvm::utohexstr(reloc->target(), true, 8) + "," +
                    llvm::utohexstr(jalr_instr, true, 8)
             << llvm::utohexstr(compressed, true, 4) << reloc->symInfo()->name()
-            << region->getOwningSection()->name() << llvm::utohexstr(offset)
+            << region->getOwningSection()->name()
+            << llvm::utohexstr(region->getRelaxedOffset(offset))
             << region->getOwningSection()
                    ->getInputFile()
                    ->getInput()
@@ -280,11 +332,11 @@ bool RISCVLDBackend::doRelaxationCall(Relocation *reloc, bool DoCompressed) {
       reloc->setTargetData(compressed);
       // Delete the next instruction
       relaxDeleteBytes("RISCV_CALL_C", *region, offset + 2, 6,
-                       reloc->symInfo()->name());
+                       reloc->symInfo()->name(), Stats);
       return true;
     }
     reportMissedRelaxation("RISCV_CALL_C", *region, offset, 2,
-                           reloc->symInfo()->name());
+                           reloc->symInfo()->name(), Stats);
   }
 
   // Replace the instruction to JAL
@@ -295,11 +347,12 @@ bool RISCVLDBackend::doRelaxationCall(Relocation *reloc, bool DoCompressed) {
   reloc->setTargetData(instr);
   // Delete the next instruction
   relaxDeleteBytes("RISCV_CALL", *region, offset + 4, 4,
-                   reloc->symInfo()->name());
+                   reloc->symInfo()->name(), Stats);
   return true;
 }
 
-bool RISCVLDBackend::doRelaxationQCCall(Relocation *reloc, bool DoCompressed) {
+bool RISCVLDBackend::doRelaxationQCCall(Relocation *reloc, bool DoCompressed,
+                                        RISCVRelaxationStats &Stats) {
   // This function performs the relaxation to replace: QC.E.JAL or QC.E.J with
   // one of JAL, C.J, or C.JAL.
 
@@ -313,9 +366,9 @@ bool RISCVLDBackend::doRelaxationQCCall(Relocation *reloc, bool DoCompressed) {
   uint64_t qc_e_jump = reloc->target() & 0xffffffffffff;
   bool isTailCall = (qc_e_jump & 0xf1f07f) == 0x00401f;
 
-  Relocator::DWord S = getSymbolValuePLT(*reloc);
+  Relocator::DWord S = getSymbolValuePLT(*reloc, region);
   Relocator::DWord A = reloc->addend();
-  Relocator::DWord P = reloc->place(m_Module);
+  Relocator::DWord P = getRelaxedPlace(*reloc, *region);
   Relocator::DWord X = S + A - P;
 
   bool canRelaxXqci =
@@ -326,7 +379,8 @@ bool RISCVLDBackend::doRelaxationQCCall(Relocation *reloc, bool DoCompressed) {
 
   if (!canRelax) {
     reportMissedRelaxation("RISCV_QC_E_CALL", *region, offset,
-                           canCompress ? 4 : 2, reloc->symInfo()->name());
+                           canCompress ? 4 : 2, reloc->symInfo()->name(),
+                           Stats);
     return false;
   }
 
@@ -338,7 +392,8 @@ bool RISCVLDBackend::doRelaxationQCCall(Relocation *reloc, bool DoCompressed) {
       config().raise(Diag::relax_to_compress)
           << msg << llvm::utohexstr(qc_e_jump, true, 12)
           << llvm::utohexstr(compressed, true, 4) << reloc->symInfo()->name()
-          << region->getOwningSection()->name() << llvm::utohexstr(offset)
+          << region->getOwningSection()->name()
+          << llvm::utohexstr(region->getRelaxedOffset(offset))
           << region->getOwningSection()
                  ->getInputFile()
                  ->getInput()
@@ -349,7 +404,7 @@ bool RISCVLDBackend::doRelaxationQCCall(Relocation *reloc, bool DoCompressed) {
     reloc->setType(llvm::ELF::R_RISCV_RVC_JUMP);
     reloc->setTargetData(compressed);
     relaxDeleteBytes(msg, *region, offset + 2, 4,
-                     reloc->symInfo()->name());
+                     reloc->symInfo()->name(), Stats);
     return true;
   }
 
@@ -363,12 +418,13 @@ bool RISCVLDBackend::doRelaxationQCCall(Relocation *reloc, bool DoCompressed) {
   // Delete the next instruction
   const char *msg = isTailCall ? "RISCV_QC_E_J" : "RISCV_QC_E_JAL";
   relaxDeleteBytes(msg, *region, offset + 4, 2,
-                   reloc->symInfo()->name());
+                   reloc->symInfo()->name(), Stats);
 
   return true;
 }
 
-bool RISCVLDBackend::doRelaxationLui(Relocation *reloc, Relocator::DWord G) {
+bool RISCVLDBackend::doRelaxationLui(Relocation *reloc, Relocator::DWord G,
+                                     RISCVRelaxationStats &Stats) {
 
   /* Three types of relaxation can be applied here, in order of preference:
    * -- zero-page: LUI is deleted and the other instruction is converted to
@@ -381,8 +437,8 @@ bool RISCVLDBackend::doRelaxationLui(Relocation *reloc, Relocator::DWord G) {
   if (!region)
     return false;
 
-  size_t SymbolSize = reloc->symInfo()->outSymbol()->size();
-  Relocator::DWord S = getSymbolValuePLT(*reloc);
+  size_t SymbolSize = getRelaxedSymbolSize(reloc->symInfo(), *region);
+  Relocator::DWord S = getSymbolValuePLT(*reloc, region);
   Relocator::DWord A = reloc->addend();
   Relocator::DWord Value = S + A;
   uint64_t offset = reloc->targetRef()->offset();
@@ -415,7 +471,8 @@ bool RISCVLDBackend::doRelaxationLui(Relocation *reloc, Relocator::DWord G) {
       Msg = "RISCV_LUI_GP";
     if (!Msg.empty()) {
       reloc->setType(llvm::ELF::R_RISCV_NONE);
-      relaxDeleteBytes(Msg, *region, offset, 4, reloc->symInfo()->name());
+      relaxDeleteBytes(Msg, *region, offset, 4, reloc->symInfo()->name(),
+                       Stats);
       return true;
     }
 
@@ -453,20 +510,20 @@ bool RISCVLDBackend::doRelaxationLui(Relocation *reloc, Relocator::DWord G) {
       // Still report missing 2-byte relaxation opportunity because we only save
       // two bytes out of four.
       reportMissedRelaxation("RISCV_LUI_GP", *region, offset, 2,
-                             reloc->symInfo()->name());
+                             reloc->symInfo()->name(), Stats);
 
       // Replace encoding and relocation type, keep the register.
       unsigned compressed = 0x6001u | rd << 7;
       reloc->setTargetData(compressed);
       reloc->setType(ELF::riscv::internal::R_RISCV_RVC_LUI);
       relaxDeleteBytes("RISCV_LUI_C", *region, offset + 2, 2,
-                       reloc->symInfo()->name());
+                       reloc->symInfo()->name(), Stats);
       if (m_Module.getPrinter()->isVerbose())
         config().raise(Diag::relax_to_compress)
             << "RISCV_LUI_C" << llvm::utohexstr(instr, true, 8)
             << llvm::utohexstr(compressed, true, 4) << reloc->symInfo()->name()
             << region->getOwningSection()->name()
-            << llvm::utohexstr(offset, true)
+            << llvm::utohexstr(region->getRelaxedOffset(offset), true)
             << region->getOwningSection()
                    ->getInputFile()
                    ->getInput()
@@ -479,7 +536,7 @@ bool RISCVLDBackend::doRelaxationLui(Relocation *reloc, Relocator::DWord G) {
     // cannot have lui with absolute relocations, anyway.
     if (!config().isCodeIndep())
       reportMissedRelaxation("RISCV_LUI_GP", *region, offset, 4,
-                             reloc->symInfo()->name());
+                             reloc->symInfo()->name(), Stats);
     return false;
   }
 
@@ -513,7 +570,8 @@ bool RISCVLDBackend::doRelaxationLui(Relocation *reloc, Relocator::DWord G) {
   return true;
 }
 
-bool RISCVLDBackend::doRelaxationQCLi(Relocation *reloc, Relocator::DWord G) {
+bool RISCVLDBackend::doRelaxationQCLi(Relocation *reloc, Relocator::DWord G,
+                                      RISCVRelaxationStats &Stats) {
   /* Three similar relaxations can be applied here, in order of preference:
    * -- qc.e.li -> c.lui (saves 4 bytes)
    * -- qc.li   -> c.lui (saves 2 bytes)
@@ -526,13 +584,13 @@ bool RISCVLDBackend::doRelaxationQCLi(Relocation *reloc, Relocator::DWord G) {
   if (!region)
     return false;
 
-  Relocator::DWord S = getSymbolValuePLT(*reloc);
+  Relocator::DWord S = getSymbolValuePLT(*reloc, region);
   Relocator::DWord A = reloc->addend();
   Relocator::DWord Value = S + A;
 
   Relocation::Type type = reloc->type();
   uint64_t offset = reloc->targetRef()->offset();
-  size_t SymbolSize = reloc->symInfo()->outSymbol()->size();
+  size_t SymbolSize = getRelaxedSymbolSize(reloc->symInfo(), *region);
 
   uint64_t instr = reloc->target();
   bool isQC_E_LI = false;
@@ -591,12 +649,13 @@ bool RISCVLDBackend::doRelaxationQCLi(Relocation *reloc, Relocator::DWord G) {
     reloc->setTargetData(c_lui);
     reloc->setType(ELF::riscv::internal::R_RISCV_RVC_LUI);
     relaxDeleteBytes(msg, *region, offset + 2, isQC_E_LI ? 4 : 2,
-                     reloc->symInfo()->name());
+                     reloc->symInfo()->name(), Stats);
     if (m_Module.getPrinter()->isVerbose())
       config().raise(Diag::relax_to_compress)
           << msg << llvm::utohexstr(instr, true, isQC_E_LI ? 12 : 8)
           << llvm::utohexstr(c_lui, true, 4) << reloc->symInfo()->name()
-          << region->getOwningSection()->name() << llvm::utohexstr(offset, true)
+          << region->getOwningSection()->name()
+          << llvm::utohexstr(region->getRelaxedOffset(offset), true)
           << region->getOwningSection()
                  ->getInputFile()
                  ->getInput()
@@ -612,11 +671,12 @@ bool RISCVLDBackend::doRelaxationQCLi(Relocation *reloc, Relocator::DWord G) {
     region->replaceInstruction(offset, reloc, qc_li, 4);
     reloc->setTargetData(qc_li);
     reloc->setType(ELF::riscv::internal::R_RISCV_QC_ABS20_U);
-    relaxDeleteBytes(msg, *region, offset + 4, 2, reloc->symInfo()->name());
+    relaxDeleteBytes(msg, *region, offset + 4, 2, reloc->symInfo()->name(),
+                     Stats);
 
     // Report missed relaxation as a C.LUI would have been smaller
     reportMissedRelaxation("RISCV_QC_E_LI_C_LUI", *region, offset, 2,
-                           reloc->symInfo()->name());
+                           reloc->symInfo()->name(), Stats);
     return true;
   }
 
@@ -628,21 +688,23 @@ bool RISCVLDBackend::doRelaxationQCLi(Relocation *reloc, Relocator::DWord G) {
     region->replaceInstruction(offset, reloc, addi, 4);
     reloc->setTargetData(addi);
     reloc->setType(ELF::riscv::internal::R_RISCV_GPREL_I);
-    relaxDeleteBytes(msg, *region, offset + 4, 2, reloc->symInfo()->name());
+    relaxDeleteBytes(msg, *region, offset + 4, 2, reloc->symInfo()->name(),
+                     Stats);
 
     // Report missed relaxation as C.LUI would have been smaller
     reportMissedRelaxation("RISCV_QC_E_LI_C_LUI", *region, offset, 2,
-                           reloc->symInfo()->name());
+                           reloc->symInfo()->name(), Stats);
     return true;
   }
 
   if (canRelaxXqci)
     reportMissedRelaxation(msg, *region, offset, isQC_E_LI ? 4 : 2,
-                           reloc->symInfo()->name());
+                           reloc->symInfo()->name(), Stats);
   return false;
 }
 
-bool RISCVLDBackend::doRelaxationAlign(Relocation *pReloc) {
+bool RISCVLDBackend::doRelaxationAlign(Relocation *pReloc,
+                                       RISCVRelaxationStats &Stats) {
   FragmentRef *Ref = pReloc->targetRef();
   Fragment *frag = Ref->frag();
   RegionFragmentEx *region = llvm::dyn_cast<RegionFragmentEx>(frag);
@@ -655,8 +717,9 @@ bool RISCVLDBackend::doRelaxationAlign(Relocation *pReloc) {
   while (Alignment <= pReloc->addend())
     Alignment = Alignment * 2;
 
-  uint64_t SymValue =
-      frag->getOutputELFSection()->addr() + Ref->getOutputOffset(m_Module);
+  uint64_t SymValue = frag->getOutputELFSection()->addr() +
+                      Ref->getOutputOffset(m_Module) - offset +
+                      region->getRelaxedOffset(offset);
 
   // Figure out how far we are from the TargetAddress
   uint64_t TargetAddress = SymValue;
@@ -669,7 +732,8 @@ bool RISCVLDBackend::doRelaxationAlign(Relocation *pReloc) {
     config().raise(Diag::error_riscv_relaxation_align)
         << pReloc->addend() << NopBytesToAdd
         << region->getOwningSection()->name()
-        << llvm::utohexstr(offset + NopBytesToAdd, true)
+        << llvm::utohexstr(region->getRelaxedOffset(offset + NopBytesToAdd),
+                           true)
         << region->getOwningSection()
                ->getInputFile()
                ->getInput()
@@ -680,7 +744,7 @@ bool RISCVLDBackend::doRelaxationAlign(Relocation *pReloc) {
   if (m_Module.getPrinter()->isVerbose())
     config().raise(Diag::add_nops)
         << "RISCV_ALIGN" << NopBytesToAdd << region->getOwningSection()->name()
-        << llvm::utohexstr(offset, true)
+        << llvm::utohexstr(region->getRelaxedOffset(offset), true)
         << region->getOwningSection()
                ->getInputFile()
                ->getInput()
@@ -688,7 +752,7 @@ bool RISCVLDBackend::doRelaxationAlign(Relocation *pReloc) {
 
   region->addRequiredNops(offset, NopBytesToAdd);
   relaxDeleteBytes("RISCV_ALIGN", *region, offset + NopBytesToAdd,
-                   pReloc->addend() - NopBytesToAdd, "");
+                   pReloc->addend() - NopBytesToAdd, "", Stats);
   // Set the reloc to do nothing.
   pReloc->setType(llvm::ELF::R_RISCV_NONE);
   return true;
@@ -759,7 +823,8 @@ bool RISCVLDBackend::isGOTReloc(Relocation *reloc) const {
   return false;
 }
 
-bool RISCVLDBackend::doRelaxationPC(Relocation *reloc, Relocator::DWord G) {
+bool RISCVLDBackend::doRelaxationPC(Relocation *reloc, Relocator::DWord G,
+                                    RISCVRelaxationStats &Stats) {
 
   // There is no GP for shared objects.
   if (config().isCodeIndep())
@@ -774,8 +839,8 @@ bool RISCVLDBackend::doRelaxationPC(Relocation *reloc, Relocator::DWord G) {
     return false;
 
   // Test if the symbol with size can fall in 12 bits.
-  size_t SymbolSize = reloc->symInfo()->outSymbol()->size();
-  Relocator::DWord S = getSymbolValuePLT(*reloc);
+  size_t SymbolSize = getRelaxedSymbolSize(reloc->symInfo(), *region);
+  Relocator::DWord S = getSymbolValuePLT(*reloc, region);
   Relocator::DWord A = reloc->addend();
 
   Relocation::Type new_type = 0x0;
@@ -793,16 +858,16 @@ bool RISCVLDBackend::doRelaxationPC(Relocation *reloc, Relocator::DWord G) {
 
   if (new_type) {
     // Lookup reloc to get actual addend of HI.
-    Relocation *HIReloc = m_PairedRelocs[reloc];
+    Relocation *HIReloc = m_PairedRelocs.lookup(reloc);
     // If this is a GOT relocation, we cannot convert
     // this relative to GP.
     if (isGOTReloc(HIReloc))
       return false;
     if (!HIReloc)
       ASSERT(0, "HIReloc not found! Internal Error!");
-    S = getSymbolValuePLT(*HIReloc);
+    S = getSymbolValuePLT(*HIReloc, region);
     A = HIReloc->addend();
-    SymbolSize = HIReloc->symInfo()->outSymbol()->size();
+    SymbolSize = getRelaxedSymbolSize(HIReloc->symInfo(), *region);
   }
 
   uint64_t offset = reloc->targetRef()->offset();
@@ -814,13 +879,13 @@ bool RISCVLDBackend::doRelaxationPC(Relocation *reloc, Relocator::DWord G) {
   if (type == llvm::ELF::R_RISCV_PCREL_HI20) {
     if (!canRelax) {
       reportMissedRelaxation("RISCV_PC_GP", *region, offset, 4,
-                             reloc->symInfo()->name());
+                             reloc->symInfo()->name(), Stats);
       return false;
     }
 
     reloc->setType(llvm::ELF::R_RISCV_NONE);
     relaxDeleteBytes("RISCV_PC_GP", *region, offset, 4,
-                     reloc->symInfo()->name());
+                     reloc->symInfo()->name(), Stats);
     return true;
   }
 
@@ -868,8 +933,7 @@ void RISCVLDBackend::translatePseudoRelocation(Relocation *reloc) {
   // address and saved in a register. Account for the change in PC when
   // computing lower 12 bits.
   uint64_t offset = reloc->targetRef()->offset();
-  FragmentRef *fragRef =
-      make<FragmentRef>(*(reloc->targetRef()->frag()), offset + 4);
+  FragmentRef fragRef(*(reloc->targetRef()->frag()), offset + 4);
   Relocation *reloc_jalr = Relocation::Create(llvm::ELF::R_RISCV_PCREL_LO12_I,
                                               32, fragRef, reloc->addend());
   m_PairedRelocs[reloc_jalr] = reloc;
@@ -885,6 +949,70 @@ enum RelaxationPass {
   RELAXATION_PASS_COUNT, // Number of passes
 };
 
+bool RISCVLDBackend::relaxSection(ELFSection &S, int relaxation_pass,
+                                  Relocator::DWord GP, bool DoCompressed,
+                                  RISCVRelaxationStats &Stats) {
+  bool Changed = false;
+  llvm::SmallVectorImpl<Relocation *> &relocList = S.getRelocations();
+  for (llvm::SmallVectorImpl<Relocation *>::iterator it = relocList.begin();
+       it != relocList.end(); ++it) {
+    auto relocation = *it;
+    // Check if the next relocation is a RELAX relocation.
+    Relocation::Type type = relocation->type();
+    llvm::SmallVectorImpl<Relocation *>::iterator it2 = it + 1;
+    Relocation *nextRelax = nullptr;
+    if (it2 != relocList.end()) {
+      nextRelax = *it2;
+      if (nextRelax->type() != llvm::ELF::R_RISCV_RELAX)
+        nextRelax = nullptr;
+    }
+
+    // try to relax
+    switch (type) {
+    case llvm::ELF::R_RISCV_CALL:
+    case llvm::ELF::R_RISCV_CALL_PLT: {
+      if (nextRelax && relaxation_pass == RELAXATION_CALL)
+        doRelaxationCall(relocation, DoCompressed, Stats);
+      break;
+    }
+    case llvm::ELF::R_RISCV_PCREL_HI20:
+    case llvm::ELF::R_RISCV_PCREL_LO12_I:
+    case llvm::ELF::R_RISCV_PCREL_LO12_S: {
+      if (nextRelax && relaxation_pass == RELAXATION_PC)
+        doRelaxationPC(relocation, GP, Stats);
+      break;
+    }
+    case llvm::ELF::R_RISCV_LO12_S:
+    case llvm::ELF::R_RISCV_LO12_I:
+    case llvm::ELF::R_RISCV_HI20: {
+      if (nextRelax && relaxation_pass == RELAXATION_LUI)
+        doRelaxationLui(relocation, GP, Stats);
+      break;
+    }
+    case llvm::ELF::R_RISCV_ALIGN: {
+      if (relaxation_pass == RELAXATION_ALIGN)
+        if (doRelaxationAlign(relocation, Stats))
+          Changed = true;
+      break;
+    }
+    case ELF::riscv::internal::R_RISCV_QC_E_CALL_PLT: {
+      if (nextRelax && relaxation_pass == RELAXATION_CALL)
+        doRelaxationQCCall(relocation, DoCompressed, Stats);
+      break;
+    }
+    case ELF::riscv::internal::R_RISCV_QC_E_32:
+    case ELF::riscv::internal::R_RISCV_QC_ABS20_U: {
+      if (nextRelax && relaxation_pass == RELAXATION_LUI)
+        doRelaxationQCLi(relocation, GP, Stats);
+      break;
+    }
+    }
+    if (!config().getDiagEngine()->diagnose())
+      break;
+  } // for all relocations
+  return Changed;
+}
+
 void RISCVLDBackend::mayBeRelax(int relaxation_pass, bool &pFinished) {
   pFinished = true;
   // RELAXATION_ALIGN pass, which is the last pass, will set pFinished to
@@ -903,7 +1031,7 @@ void RISCVLDBackend::mayBeRelax(int relaxation_pass, bool &pFinished) {
   // Compress
   bool DoCompressed = config().options().getRISCVRelaxToC();
 
-  // start relocation relaxation
+  std::vector<ELFSection *> Sections;
   for (auto &input : m_Module.getObjectList()) {
     ELFObjectFile *ObjFile = llvm::dyn_cast<ELFObjectFile>(input);
     if (!ObjFile)
@@ -914,70 +1042,57 @@ void RISCVLDBackend::mayBeRelax(int relaxation_pass, bool &pFinished) {
         continue;
       if (rs->isDiscard())
         continue;
-      llvm::SmallVectorImpl<Relocation *> &relocList =
-          rs->getLink()->getRelocations();
-      for (llvm::SmallVectorImpl<Relocation *>::iterator it = relocList.begin();
-           it != relocList.end(); ++it) {
-        auto relocation = *it;
-        // Check if the next relocation is a RELAX relocation.
-        Relocation::Type type = relocation->type();
-        llvm::SmallVectorImpl<Relocation *>::iterator it2 = it + 1;
-        Relocation *nextRelax = nullptr;
-        if (it2 != relocList.end()) {
-          nextRelax = *it2;
-          if (nextRelax->type() != llvm::ELF::R_RISCV_RELAX)
-            nextRelax = nullptr;
-        }
-
-        // try to relax
-        switch (type) {
-        case llvm::ELF::R_RISCV_CALL:
-        case llvm::ELF::R_RISCV_CALL_PLT: {
-          if (nextRelax && relaxation_pass == RELAXATION_CALL)
-            doRelaxationCall(relocation, DoCompressed);
-          break;
-        }
-        case llvm::ELF::R_RISCV_PCREL_HI20:
-        case llvm::ELF::R_RISCV_PCREL_LO12_I:
-        case llvm::ELF::R_RISCV_PCREL_LO12_S: {
-          if (nextRelax && relaxation_pass == RELAXATION_PC)
-            doRelaxationPC(relocation, GP);
-          break;
-        }
-        case llvm::ELF::R_RISCV_LO12_S:
-        case llvm::ELF::R_RISCV_LO12_I:
-        case llvm::ELF::R_RISCV_HI20: {
-          if (nextRelax && relaxation_pass == RELAXATION_LUI)
-            doRelaxationLui(relocation, GP);
-          break;
-        }
-        case llvm::ELF::R_RISCV_ALIGN: {
-          if (relaxation_pass == RELAXATION_ALIGN)
-            if (doRelaxationAlign(relocation))
-              pFinished = false;
-          break;
-        }
-        case ELF::riscv::internal::R_RISCV_QC_E_CALL_PLT: {
-          if (nextRelax && relaxation_pass == RELAXATION_CALL)
-            doRelaxationQCCall(relocation, DoCompressed);
-          break;
-        }
-        case ELF::riscv::internal::R_RISCV_QC_E_32:
-        case ELF::riscv::internal::R_RISCV_QC_ABS20_U: {
-          if (nextRelax && relaxation_pass == RELAXATION_LUI)
-            doRelaxationQCLi(relocation, GP);
-          break;
-        }
-        }
-        if (!config().getDiagEngine()->diagnose()) {
-          m_Module.setFailure(true);
-          pFinished = true;
-          return;
-        }
-      } // for all relocations
-    } // for all relocation section
+      Sections.push_back(rs->getLink());
+    }
   }
 
+  // Each section collects its own statistics; they are merged in section
+  // order once the pass is done.
+  std::vector<RISCVRelaxationStats> SectionStats(Sections.size());
+  std::atomic<bool> Changed(false);
+  auto RelaxSection = [&](size_t I) {
+    if (relaxSection(*Sections[I], relaxation_pass, GP, DoCompressed,
+                     SectionStats[I]))
+      Changed = true;
+  };
+
+  // Verbose diagnostics are raised while sections are relaxed, so sections
+  // are relaxed serially to keep them in order.
+  m_RelaxSectionsConcurrently = config().options().numThreads() > 1 &&
+                                config().isLinkerRelaxationMultiThreaded() &&
+                                !m_Module.getPrinter()->isVerbose();
+  if (!m_RelaxSectionsConcurrently) {
+    for (size_t I = 0, E = Sections.size(); I != E; ++I) {
+      RelaxSection(I);
+      if (!config().getDiagEngine()->diagnose())
+        break;
+    }
+  } else {
+    llvm::parallelFor((size_t)0, Sections.size(), RelaxSection);
+    m_RelaxSectionsConcurrently = false;
+  }
+
+  // Merge statistics and compact every region that had bytes deleted in this
+  // pass.
+  for (size_t I = 0, E = Sections.size(); I != E; ++I) {
+    const RISCVRelaxationStats &Stats = SectionStats[I];
+    if (Stats.getBytesDeleted() || Stats.getBytesNotDeleted())
+      recordRelaxationStats(*Sections[I], Stats.getBytesDeleted(),
+                            Stats.getBytesNotDeleted());
+    for (Fragment *F : Sections[I]->getFragmentList())
+      if (auto *Region = llvm::dyn_cast<RegionFragmentEx>(F))
+        Region->applyPendingDeletions();
+  }
+
+  if (!config().getDiagEngine()->diagnose()) {
+    m_Module.setFailure(true);
+    pFinished = true;
+    return;
+  }
+
+  if (Changed)
+    pFinished = false;
+
   // On RISC-V, relaxation consists of a fixed number of passes, except
   // R_RISCV_ALIGN will cause another empty pass if it made changes.
   if (relaxation_pass < llvm::ELF::R_RISCV_ALIGN)
@@ -1226,6 +1341,10 @@ bool RISCVLDBackend::handleRelocation(ELFSection *pSection,
   return false;
 }
 
+bool RISCVLDBackend::mayHandleRelocations(const ELFSection *pSection) const {
+  return config().codeGenType() != LinkerConfig::Object;
+}
+
 bool RISCVLDBackend::handlePendingRelocations(ELFSection *section) {
 
   std::optional<Relocation *> lastRelocationVisited;
@@ -1484,7 +1603,7 @@ RISCVPLT *RISCVLDBackend::createPLT(ELFObjectFile *Obj, ResolveInfo *R) {
     // it will store the real symbol value.
     Relocation *Rel = Relocation::Create(
         is32Bits ? llvm::ELF::R_RISCV_32 : llvm::ELF::R_RISCV_64,
-        is32Bits ? 32 : 64, make<FragmentRef>(*G));
+        is32Bits ? 32 : 64, FragmentRef(*G));
     Rel->setSymInfo(R);
     getRelaPatch()->addRelocation(Rel);
     // Point the `__llvm_patchable` alias to the PLT slot. If a patchable
@@ -1505,7 +1624,7 @@ RISCVPLT *RISCVLDBackend::createPLT(ELFObjectFile *Obj, ResolveInfo *R) {
       // Create a static relocation to the PLT0 fragment.
       Relocation *r0 = Relocation::Create(
           is32Bits ? llvm::ELF::R_RISCV_32 : llvm::ELF::R_RISCV_64,
-          is32Bits ? 32 : 64, make<FragmentRef>(*G));
+          is32Bits ? 32 : 64, FragmentRef(*G));
       r0->modifyRelocationFragmentRef(
           make<FragmentRef>(**getPLT()->getFragmentList().begin()));
       Obj->getGOTPLT()->addRelocation(r0);
@@ -1513,7 +1632,7 @@ RISCVPLT *RISCVLDBackend::createPLT(ELFObjectFile *Obj, ResolveInfo *R) {
     // Create a dynamic relocation for the GOTPLT slot.
     Relocation *dynRel =
         Relocation::Create(llvm::ELF::R_RISCV_JUMP_SLOT, is32Bits ? 32 : 64,
-                           make<FragmentRef>(*G));
+                           FragmentRef(*G));
     dynRel->setSymInfo(R);
     Obj->getRelaPLT()->addRelocation(dynRel);
   }
@@ -84,6 +84,8 @@ public:
   // Handle the relocations that handleRelocation() could not process.
   bool handlePendingRelocations(ELFSection *S) override;
 
+  bool mayHandleRelocations(const ELFSection *pSection) const override;
+
   virtual bool readSection(InputFile &pInput, ELFSection *S) override;
 
   bool shouldIgnoreRelocSync(Relocation *pReloc) const override;
@@ -175,8 +177,11 @@ public:
     return reloc->second;
   }
 
-  // Get the value of the symbol, using the PLT slot if one exists.
-  Relocation::Address getSymbolValuePLT(Relocation &R);
+  // Get the value of the symbol, using the PLT slot if one exists. When
+  // \p Region is being relaxed, bytes already deleted before the symbol in
+  // this pass are discounted.
+  Relocation::Address
+  getSymbolValuePLT(Relocation &R, const RegionFragmentEx *Region = nullptr);
 
 private:
   Relocation *findHIRelocation(ELFSection *S, uint64_t Value);
@@ -189,23 +194,53 @@ private:
 
   void relaxDeleteBytes(llvm::StringRef Name, RegionFragmentEx &Region,
                         uint64_t Offset, unsigned NumBytes,
-                        llvm::StringRef SymbolName);
+                        llvm::StringRef SymbolName,
+                        RISCVRelaxationStats &Stats);
 
   void reportMissedRelaxation(llvm::StringRef Name, RegionFragmentEx &Region,
                               uint64_t Offset, unsigned NumBytes,
-                              llvm::StringRef SymbolName);
+                              llvm::StringRef SymbolName,
+                              RISCVRelaxationStats &Stats);
+
+  /// Address of the relocated place, discounting bytes deleted from \p Region
+  /// earlier in the current pass.
+  Relocation::Address getRelaxedPlace(const Relocation &R,
+                                      const RegionFragmentEx &Region) const;
+
+  /// Size of the symbol, discounting bytes deleted from it earlier in the
+  /// current pass.
+  size_t getRelaxedSymbolSize(const ResolveInfo *Info,
+                              const RegionFragmentEx &Region) const;
+
+  /// Region whose pending deletions apply to \p Ref while \p Region is
+  /// relaxed, or nullptr if none do.
+  const RegionFragmentEx *getRelaxedRegion(const FragmentRef *Ref,
+                                           const RegionFragmentEx &Region) const;
+
+  /// Run one relaxation pass over the relocations of \p S. When sections are
+  /// relaxed concurrently, decisions only depend on addresses assigned before
+  /// the pass and on bytes of \p S. Serially, they also see the bytes deleted
+  /// from sections relaxed earlier in the pass. Returns true if an
+  /// R_RISCV_ALIGN changed the section.
+  bool relaxSection(ELFSection &S, int RelaxationPass, Relocation::DWord GP,
+                    bool DoCompressed, RISCVRelaxationStats &Stats);
 
   bool isGOTReloc(Relocation *reloc) const;
 
-  bool doRelaxationCall(Relocation *R, bool DoCompressed);
-  bool doRelaxationQCCall(Relocation *R, bool DoCompressed);
+  bool doRelaxationCall(Relocation *R, bool DoCompressed,
+                        RISCVRelaxationStats &Stats);
+  bool doRelaxationQCCall(Relocation *R, bool DoCompressed,
+                          RISCVRelaxationStats &Stats);
 
-  bool doRelaxationLui(Relocation *R, Relocation::DWord G);
-  bool doRelaxationQCLi(Relocation *R, Relocation::DWord G);
+  bool doRelaxationLui(Relocation *R, Relocation::DWord G,
+                       RISCVRelaxationStats &Stats);
+  bool doRelaxationQCLi(Relocation *R, Relocation::DWord G,
+                        RISCVRelaxationStats &Stats);
 
-  bool doRelaxationAlign(Relocation *R);
+  bool doRelaxationAlign(Relocation *R, RISCVRelaxationStats &Stats);
 
-  bool doRelaxationPC(Relocation *R, Relocation::DWord G);
+  bool doRelaxationPC(Relocation *R, Relocation::DWord G,
+                      RISCVRelaxationStats &Stats);
 
   /// getRelEntrySize - the size in BYTE of rela type relocation
   size_t getRelEntrySize() override { return 0; }
@@ -263,6 +298,8 @@ private:
                  Relocation::Address>;
   std::vector<PendingRelocInfo> m_PendingRelocations;
   std::unordered_set<Relocation *> m_DisableGPRelocs;
+  /// True while a relaxation pass relaxes sections concurrently.
+  bool m_RelaxSectionsConcurrently = false;
   Relocator *m_pRelocator = nullptr;
   LDSymbol *m_pGlobalPointer = nullptr;
   ELFSection *m_GlobalPointerSection = nullptr;
@@ -22,6 +22,9 @@ public:
   void addBytesDeleted(size_t bytes) { numBytesDeleted += bytes; }
   void addBytesNotDeleted(size_t bytes) { numBytesNotDeleted += bytes; }
 
+  size_t getBytesDeleted() const { return numBytesDeleted; }
+  size_t getBytesNotDeleted() const { return numBytesNotDeleted; }
+
 private:
   size_t numBytesDeleted = 0;
   size_t numBytesNotDeleted = 0;
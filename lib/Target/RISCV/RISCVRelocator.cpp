@@ -13,8 +13,10 @@
 #include "eld/Support/MsgHandling.h"
 #include "eld/SymbolResolver/LDSymbol.h"
 #include "eld/SymbolResolver/Resolver.h"
+#include "eld/Target/RelocationTable.h"
 #include "llvm/ADT/Twine.h"
 #include "llvm/BinaryFormat/ELF.h"
+#include <array>
 
 namespace eld {
 
@@ -28,10 +30,10 @@ typedef Relocator::Result (*ApplyFunctionType)(
 
 struct RelocationDescription {
   // The application function for the relocation.
-  const ApplyFunctionType func;
+  ApplyFunctionType func;
   // The Relocation type, this is just kept for convenience when writing new
   // handlers for relocations.
-  const Relocator::Type type;
+  Relocator::Type type;
   // If the user specified, the relocation to be force verified, the relocation
   // is verified for alignment, truncation errors(only for relocations that take
   // in non signed values, signed values are bound to exceed the number of
@@ -60,8 +62,10 @@ DECL_RISCV_APPLY_RELOC_FUNC(applyVendor)
 
 #undef DECL_RISCV_APPLY_RELOC_FUNC
 
-typedef std::unordered_map<Relocator::Type, RelocationDescription>
-    RelocationDescMap;
+typedef std::pair<Relocator::Type, RelocationDescription> RelocationDescEntry;
+
+constexpr size_t NumRelocDescs =
+    eld::ELF::riscv::internal::LastInternalRelocation + 1;
 
 #define PUBLIC_RELOC_DESC_ENTRY(type, fptr)                                    \
   {                                                                            \
@@ -78,8 +82,7 @@ typedef std::unordered_map<Relocator::Type, RelocationDescription>
     }                                                                          \
   }
 
-/* Not const: the `forceVerify` entries might be changed. */
-RelocationDescMap RelocDescs = {
+const RelocationDescEntry RelocDescList[] = {
     PUBLIC_RELOC_DESC_ENTRY(R_RISCV_NONE, applyNone),
     PUBLIC_RELOC_DESC_ENTRY(R_RISCV_32, applyAbs),
     PUBLIC_RELOC_DESC_ENTRY(R_RISCV_64, applyAbs),
@@ -150,6 +153,20 @@ RelocationDescMap RelocDescs = {
 #undef INTERNAL_RELOC_DESC_ENTRY
 #undef PUBLIC_RELOC_DESC_ENTRY
 
+/* Indexed by relocation type. Not const: the `forceVerify` entries might be
+ * changed. */
+std::array<RelocationDescription, NumRelocDescs> RelocDescs =
+    createRelocationTable<RelocationDescription, NumRelocDescs>(
+        RelocDescList);
+
+/// Returns the description of the relocation type, or nullptr if the type is
+/// not supported.
+RelocationDescription *getRelocDesc(Relocator::Type Type) {
+  if (Type >= NumRelocDescs || !RelocDescs[Type].func)
+    return nullptr;
+  return &RelocDescs[Type];
+}
+
 } // anonymous namespace
 
 //===--------------------------------------------------------------------===//
@@ -162,7 +179,9 @@ RISCVRelocator::RISCVRelocator(RISCVLDBackend &Backend, LinkerConfig &pConfig,
   if (m_Module.getPrinter()->verifyReloc() &&
       config().options().verifyRelocList().size()) {
     auto &list = config().options().verifyRelocList();
-    for (auto &[i, desc] : RelocDescs) {
+    for (RelocationDescription &desc : RelocDescs) {
+      if (!desc.func)
+        continue;
       const auto RelocName = getRISCVRelocName(desc.type);
       if (list.find(RelocName) != list.end())
         desc.forceVerify = true;
@@ -182,7 +201,7 @@ Relocation *helper_DynRel_init(ELFObjectFile *Obj, Relocation *R,
 
   rela_entry = Obj->getRelaDyn()->createOneReloc();
   rela_entry->setType(pType);
-  rela_entry->setTargetRef(make<FragmentRef>(*F, pOffset));
+  rela_entry->setTargetRef(FragmentRef(*F, pOffset));
   rela_entry->setSymInfo(pSym);
   if (R)
     rela_entry->setAddend(R->addend());
@@ -235,7 +254,7 @@ Relocator::Result RISCVRelocator::applyRelocation(Relocation &pRelocation) {
     Relocation::Type type = pRelocation.type();
     ResolveInfo *symInfo = pRelocation.symInfo();
 
-    if (RelocDescs.count(type) == 0) {
+    if (!getRelocDesc(type)) {
       hasError = true;
       return Relocator::Unknown;
     }
@@ -268,12 +287,12 @@ Relocator::Result RISCVRelocator::applyRelocation(Relocation &pRelocation) {
     m_Target.translatePseudoRelocation(&pRelocation);
   }
 
-  auto Desc = RelocDescs.find(pRelocation.type());
-  if (Desc == RelocDescs.end())
+  RelocationDescription *Desc = getRelocDesc(pRelocation.type());
+  if (!Desc)
     return RISCVRelocator::Unsupport;
 
-  return Desc->second.func(
-      pRelocation, static_cast<RISCVLDBackend &>(getTarget()), Desc->second);
+  return Desc->func(pRelocation, static_cast<RISCVLDBackend &>(getTarget()),
+                    *Desc);
 }
 
 const char *RISCVRelocator::getName(Relocation::Type pType) const {
@@ -296,7 +315,7 @@ RISCVGOT *RISCVRelocator::getTLSModuleID(ResolveInfo *R, bool isStatic) {
 }
 
 bool RISCVRelocator::isRelocSupported(Relocation &pReloc) const {
-  return RelocDescs.count(pReloc.type()) != 0;
+  return getRelocDesc(pReloc.type()) != nullptr;
 }
 
 // Check if the relocation is invalid while generating
@@ -396,7 +415,7 @@ uint32_t RISCVRelocator::getNumRelocs() const {
 }
 
 Relocation::Size RISCVRelocator::getSize(Relocation::Type pType) const {
-  if (RelocDescs.count(pType) == 0)
+  if (!getRelocDesc(pType))
     return 0;
   return getRISCVReloc(pType).Size;
 }
@@ -747,7 +766,7 @@ RISCVRelocator::Result applyNone(Relocation &pReloc, RISCVLDBackend &,
 // R_RISCV_SUB*
 RISCVRelocator::Result applyAbs(Relocation &pReloc, RISCVLDBackend &Backend,
                                 RelocationDescription &pRelocDesc) {
-  if (RelocDescs.count(pReloc.type()) == 0)
+  if (!getRelocDesc(pReloc.type()))
     return RISCVRelocator::Unsupport;
 
   // Normally, relocations are resolved to the PLT if it exists for a symbol.
@@ -799,7 +818,7 @@ RISCVRelocator::Result applyAbs(Relocation &pReloc, RISCVLDBackend &Backend,
 
 RISCVRelocator::Result applyRel(Relocation &pReloc, RISCVLDBackend &Backend,
                                 RelocationDescription &pRelocDesc) {
-  if (RelocDescs.count(pReloc.type()) == 0)
+  if (!getRelocDesc(pReloc.type()))
     return RISCVRelocator::Unsupport;
 
   int64_t S = Backend.getSymbolValuePLT(pReloc);
@@ -811,7 +830,7 @@ RISCVRelocator::Result applyRel(Relocation &pReloc, RISCVLDBackend &Backend,
 
 RISCVRelocator::Result applyHI(Relocation &pReloc, RISCVLDBackend &Backend,
                                RelocationDescription &pRelocDesc) {
-  if (RelocDescs.count(pReloc.type()) == 0)
+  if (!getRelocDesc(pReloc.type()))
     return RISCVRelocator::Unsupport;
 
   int64_t S = Backend.getSymbolValuePLT(pReloc);
@@ -851,7 +870,7 @@ RISCVRelocator::Result applyHI(Relocation &pReloc, RISCVLDBackend &Backend,
 RISCVRelocator::Result applyLO(Relocation &pReloc, RISCVLDBackend &Backend,
                                RelocationDescription &pRelocDesc) {
   DiagnosticEngine *DiagEngine = Backend.config().getDiagEngine();
-  if (RelocDescs.count(pReloc.type()) == 0)
+  if (!getRelocDesc(pReloc.type()))
     return RISCVRelocator::Unsupport;
 
   int64_t S;
@@ -952,7 +971,7 @@ RISCVRelocator::Result applyRelax(Relocation &pReloc, RISCVLDBackend &,
 RISCVRelocator::Result applyJumpOrCall(Relocation &pReloc,
                                        RISCVLDBackend &Backend,
                                        RelocationDescription &pRelocDesc) {
-  if (RelocDescs.count(pReloc.type()) == 0)
+  if (!getRelocDesc(pReloc.type()))
     return RISCVRelocator::Unsupport;
 
   // Normally, relocations are resolved to the PLT if it exists for a symbol.
@@ -980,7 +999,7 @@ RISCVRelocator::Result applyAlign(Relocation &pReloc, RISCVLDBackend &Backend,
 
 RISCVRelocator::Result applyGPRel(Relocation &pReloc, RISCVLDBackend &Backend,
                                   RelocationDescription &pRelocDesc) {
-  if (RelocDescs.count(pReloc.type()) == 0)
+  if (!getRelocDesc(pReloc.type()))
     return RISCVRelocator::Unsupport;
 
   int64_t S = Backend.getSymbolValuePLT(pReloc);
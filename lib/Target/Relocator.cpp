@@ -57,7 +57,8 @@ void Relocator::partialScanRelocation(Relocation &pReloc,
 void Relocator::traceMergeStrings(const ELFSection *RelocationSection,
                                   const Relocation *R,
                                   const MergeableString *From,
-                                  const MergeableString *To) const {
+                                  const MergeableString *To,
+                                  DiagnosticList *Diagnostics) const {
   ELFSection *OutputSection =
       From->Fragment->getOwningSection()->getOutputELFSection();
   std::string OutputSectionName = From->Fragment->getOwningSection()
@@ -77,7 +78,7 @@ void Relocator::traceMergeStrings(const ELFSection *RelocationSection,
                             ->getInputFile()
                             ->getInput()
                             ->decoratedPath();
-  uint32_t NewOffset = To->InputOffset;
+  uint32_t NewOffset = To->InputOffset + To->getSuffixOffset(From);
   std::string NewSection =
       To->Fragment->getOwningSection()->getDecoratedName(m_Config.options());
   std::string NewFile = To->Fragment->getOwningSection()
@@ -85,6 +86,15 @@ void Relocator::traceMergeStrings(const ELFSection *RelocationSection,
                             ->getInput()
                             ->decoratedPath();
 
+  if (Diagnostics) {
+    Diagnostics->push_back(std::make_unique<plugin::DiagnosticEntry>(
+        Diag::modifying_mergestr_reloc,
+        std::vector<std::string>{SymName, std::to_string(Addend), Section,
+                                 File, std::to_string(OldOffset), OldSection,
+                                 OldFile, std::to_string(NewOffset),
+                                 NewSection, NewFile}));
+    return;
+  }
   m_Config.raise(Diag::modifying_mergestr_reloc)
       << SymName << Addend << Section << File << OldOffset << OldSection
       << OldFile << NewOffset << NewSection << NewFile;
@@ -93,7 +103,8 @@ void Relocator::traceMergeStrings(const ELFSection *RelocationSection,
 std::pair<Fragment *, uint64_t>
 Relocator::findFragmentForMergeStr(const ELFSection *RelocationSection,
                                    const Relocation *R,
-                                   MergeStringFragment *F) const {
+                                   MergeStringFragment *F,
+                                   DiagnosticList *Diagnostics) const {
   uint32_t Addend = getAddend(R);
   MergeableString *String = F->findString(Addend);
   uint32_t OffsetInString = Addend - String->InputOffset;
@@ -109,14 +120,15 @@ Relocator::findFragmentForMergeStr(const ELFSection *RelocationSection,
               : OutputSection->getMergedString(String)) {
     if (m_Config.getPrinter()->isVerbose() ||
         m_Config.getPrinter()->traceMergeStrings())
-      traceMergeStrings(RelocationSection, R, String, DeDuped);
+      traceMergeStrings(RelocationSection, R, String, DeDuped, Diagnostics);
+    OffsetInString += DeDuped->getSuffixOffset(String);
     String = DeDuped;
   }
 
   return {String->Fragment, String->InputOffset + OffsetInString};
 }
 
-bool Relocator::doMergeStrings(ELFSection *S) {
+bool Relocator::doMergeStrings(ELFSection *S, DiagnosticList *Diagnostics) {
   auto DoMergeStrReloc = [&](Relocation *R) -> void {
     if (!R->isMergeKind() || !R->symInfo()->isSection() ||
         getTarget().maySkipRelocProcessing(R))
@@ -126,7 +138,7 @@ bool Relocator::doMergeStrings(ELFSection *S) {
                                  : R->symInfo()->outSymbol()->fragRef();
 
     auto *MSF = llvm::cast<MergeStringFragment>(OldTarget->frag());
-    auto [Frag, Offset] = findFragmentForMergeStr(S, R, MSF);
+    auto [Frag, Offset] = findFragmentForMergeStr(S, R, MSF, Diagnostics);
     if (!Frag)
       return;
     adjustAddend(R);
@@ -20,7 +20,7 @@ x86_64GOTPLT0 *x86_64GOTPLT0::Create(ELFSection *O, ResolveInfo *R) {
   Relocation *r1 = nullptr;
 
   r1 = Relocation::Create(llvm::ELF::R_X86_64_JUMP_SLOT, 64,
-                          make<FragmentRef>(*G, 0), 0);
+                          FragmentRef(*G, 0), 0);
   r1->setSymInfo(R);
 
   O->addRelocation(r1);
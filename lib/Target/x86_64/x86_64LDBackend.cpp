@@ -209,7 +209,7 @@ x86_64PLT *x86_64LDBackend::createPLT(ELFObjectFile *Obj, ResolveInfo *R) {
   Relocation &rela_entry = *Obj->getRelaPLT()->createOneReloc();
   rela_entry.setType(llvm::ELF::R_X86_64_JUMP_SLOT);
   Fragment *F = P->getGOT();
-  rela_entry.setTargetRef(make<FragmentRef>(*F, 0));
+  rela_entry.setTargetRef(FragmentRef(*F, 0));
   rela_entry.setSymInfo(R);
   if (R)
     recordPLT(R, P);
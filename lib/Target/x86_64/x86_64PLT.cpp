@@ -35,10 +35,10 @@ x86_64PLT0 *x86_64PLT0::Create(eld::IRBuilder &I, x86_64GOT *G, ELFSection *O,
   symbol->setShouldIgnore(false);
 
   r1 = Relocation::Create(llvm::ELF::R_X86_64_JUMP_SLOT, 64,
-                          make<FragmentRef>(*P, 0), 0);
+                          FragmentRef(*P, 0), 0);
   r1->setSymInfo(symbol->resolveInfo());
   r2 = Relocation::Create(llvm::ELF::R_X86_64_JUMP_SLOT, 64,
-                          make<FragmentRef>(*P, 8), 4);
+                          FragmentRef(*P, 8), 4);
   r2->setSymInfo(symbol->resolveInfo());
   O->addRelocation(r1);
   O->addRelocation(r2);
@@ -66,10 +66,10 @@ x86_64PLTN *x86_64PLTN::Create(eld::IRBuilder &I, x86_64GOT *G, ELFSection *O,
       true /* isPostLTOPhase */);
   symbol->setShouldIgnore(false);
   r1 = Relocation::Create(llvm::ELF::R_X86_64_JUMP_SLOT, 64,
-                          make<FragmentRef>(*P, 0), 0);
+                          FragmentRef(*P, 0), 0);
   r1->setSymInfo(symbol->resolveInfo());
   r2 = Relocation::Create(llvm::ELF::R_X86_64_JUMP_SLOT, 64,
-                          make<FragmentRef>(*P, 8), 8);
+                          FragmentRef(*P, 8), 8);
   r2->setSymInfo(symbol->resolveInfo());
   O->addRelocation(r1);
   O->addRelocation(r2);
@@ -81,7 +81,7 @@ x86_64PLTN *x86_64PLTN::Create(eld::IRBuilder &I, x86_64GOT *G, ELFSection *O,
   Fragment *F = *(O->getFragmentList().begin());
   FragmentRef *PLT0FragRef = make<FragmentRef>(*F, 0);
   Relocation *r3 = Relocation::Create(llvm::ELF::R_X86_64_JUMP_SLOT, 64,
-                                      make<FragmentRef>(*G, 0), 0);
+                                      FragmentRef(*G, 0), 0);
   O->addRelocation(r3);
   r3->modifyRelocationFragmentRef(PLT0FragRef);
   return P;
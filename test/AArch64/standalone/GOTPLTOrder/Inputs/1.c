@@ -0,0 +1,9 @@
+extern __thread int t;
+void foo(void);
+void bar(void);
+int f(void) {
+  foo();
+  int v = t;
+  bar();
+  return v;
+}
@@ -0,0 +1,5 @@
+int foo();
+
+int __attribute__((section(".text.main"))) main() { return foo(); }
+
+int __attribute__((section(".text.baz"))) baz() { return 1; }
@@ -0,0 +1,16 @@
+ENTRY(main)
+SECTIONS {
+  .text (0x10000) : {
+    KEEP(*(.text.main))
+  }
+  .text2 : {
+    KEEP(*(.text.baz))
+  }
+  .far (0x30000000) : {
+    KEEP(*(.text.foo))
+  }
+  .far2 : {
+    KEEP(*(.text.qux))
+  }
+  /DISCARD/ : { *(.note.GNU-stack) *(.gnu_debuglink) *(.gnu.lto_*) }
+}
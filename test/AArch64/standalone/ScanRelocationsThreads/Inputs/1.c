@@ -0,0 +1,5 @@
+extern int x;
+extern int y;
+void foo(void);
+void bar(void);
+int f1(void) { foo(); bar(); return x + y; }
@@ -0,0 +1,5 @@
+extern int x;
+extern int y;
+void foo(void);
+void bar(void);
+int f2(void) { bar(); foo(); return y - x; }
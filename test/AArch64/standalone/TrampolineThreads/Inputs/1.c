@@ -0,0 +1,4 @@
+int foo();
+int bar();
+
+int __attribute__((section(".text.main"))) main() { return foo() + bar(); }
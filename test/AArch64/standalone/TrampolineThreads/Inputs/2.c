@@ -0,0 +1,5 @@
+int main();
+
+int __attribute__((section(".text.foo"))) foo() { return main(); }
+
+int __attribute__((section(".text.bar"))) bar() { return 100; }
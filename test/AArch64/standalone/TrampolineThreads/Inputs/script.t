@@ -0,0 +1,11 @@
+ENTRY(main)
+SECTIONS {
+  .text (0x10000) : {
+    KEEP(*(.text.main))
+  }
+  .far (0x30000000) : {
+    KEEP(*(.text.foo))
+    KEEP(*(.text.bar))
+  }
+  /DISCARD/ : { *(.note.GNU-stack) *(.gnu_debuglink) *(.gnu.lto_*) }
+}
@@ -0,0 +1,5 @@
+.section ".text.farfn", "ax", %progbits
+.arm
+.global farfn
+farfn:
+bx lr
@@ -0,0 +1,5 @@
+.section ".text.high", "ax", %progbits
+.arm
+.global high
+high:
+bl farfn
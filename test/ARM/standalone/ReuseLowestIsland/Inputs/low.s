@@ -0,0 +1,5 @@
+.section ".text.low", "ax", %progbits
+.arm
+.global low
+low:
+bl farfn
@@ -0,0 +1,5 @@
+.section ".text.mid", "ax", %progbits
+.arm
+.global mid
+mid:
+bl farfn
@@ -0,0 +1,13 @@
+ENTRY(low)
+SECTIONS {
+  .text (0x0) : {
+    *(.text.low)
+    . = 0x1080000;
+    *(.text.mid)
+    . = 0x2100000;
+    *(.text.high)
+  }
+  .far (0x8000000) : {
+    *(.text.farfn)
+  }
+}
@@ -0,0 +1,6 @@
+extern int x;
+extern int y;
+void foo(void);
+void bar(void);
+int *px = &x;
+int f1(void) { foo(); bar(); return x + y; }
@@ -0,0 +1,6 @@
+extern int x;
+extern int y;
+void foo(void);
+void bar(void);
+int *py = &y;
+int f2(void) { bar(); foo(); return y - x; }
@@ -0,0 +1,6 @@
+int thumb_far(void);
+int ext(void);
+
+int __attribute__((section(".text.main"))) main(void) {
+  return thumb_far() + ext();
+}
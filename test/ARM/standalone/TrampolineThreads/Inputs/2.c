@@ -0,0 +1,6 @@
+int main(void);
+int ext(void);
+
+int __attribute__((section(".text.thumb_far"))) thumb_far(void) {
+  return main() + ext();
+}
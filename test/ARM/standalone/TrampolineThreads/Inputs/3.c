@@ -0,0 +1 @@
+int ext(void) { return 3; }
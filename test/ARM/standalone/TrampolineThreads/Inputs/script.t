@@ -0,0 +1,11 @@
+ENTRY(main)
+SECTIONS {
+  .text (0x10000) : {
+    KEEP(*(.text.main))
+  }
+  .plt : { *(.plt) }
+  .far (0x10000000) : {
+    KEEP(*(.text.thumb_far))
+  }
+  /DISCARD/ : { *(.note.GNU-stack) *(.gnu_debuglink) *(.gnu.lto_*) }
+}
@@ -0,0 +1,4 @@
+int foo() { return 1; }
+int bar() { return 2; }
+int baz() { return 3; }
+int main() { return foo() + bar(); }
@@ -0,0 +1,7 @@
+PLUGIN_ITER_SECTIONS("incrementalgcedits", "INCREMENTALGCEDITS")
+
+SECTIONS {
+  .text : {
+     *(.text*)
+  }
+}
@@ -0,0 +1,95 @@
+#include "PluginVersion.h"
+#include "SectionIteratorPlugin.h"
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace eld::plugin;
+
+class DLL_A_EXPORT IncrementalGCEditsPlugin : public SectionIteratorPlugin {
+public:
+  IncrementalGCEditsPlugin() : SectionIteratorPlugin("INCREMENTALGCEDITS") {}
+
+  void Init(std::string Options) override {
+    getLinker()->RequestGarbageCollection();
+  }
+
+  void processSection(eld::plugin::Section S) override {
+    if (S.getName() == ".text.main")
+      m_Main = S;
+  }
+
+  Status Run(bool Trace) override {
+    eld::Expected<Symbol> Bar = getLinker()->getSymbol("bar");
+    if (!Bar) {
+      getLinker()->reportDiagEntry(std::move(Bar.error()));
+      return Plugin::Status::ERROR;
+    }
+
+    runGarbageCollection("unchanged");
+
+    // References added to sections that are not bitcode do not change the
+    // reachability.
+    eld::Expected<void> ExpRef =
+        getLinker()->addReferencedSymbol(m_Main, Bar.value());
+    if (!ExpRef) {
+      getLinker()->reportDiagEntry(std::move(ExpRef.error()));
+      return Plugin::Status::ERROR;
+    }
+    runGarbageCollection("reference");
+
+    eld::Expected<std::vector<Use>> ExpUses = getLinker()->getUses(m_Main);
+    if (!ExpUses) {
+      getLinker()->reportDiagEntry(std::move(ExpUses.error()));
+      return Plugin::Status::ERROR;
+    }
+
+    // Resetting a Use to the symbol that it already refers to is not an edit.
+    for (auto &U : ExpUses.value())
+      U.resetSymbol(U.getSymbol());
+    runGarbageCollection("same-symbol");
+
+    // Make main call bar instead of foo, which leaves foo unreferenced.
+    for (auto &U : ExpUses.value())
+      if (U.getName() == "foo")
+        U.resetSymbol(Bar.value());
+    runGarbageCollection("retarget");
+
+    runGarbageCollection("after-retarget");
+    return Plugin::Status::SUCCESS;
+  }
+
+  void runGarbageCollection(const std::string &Phase) {
+    std::cerr << "Phase " << Phase << "\n";
+    getLinker()->runGarbageCollection(Phase);
+  }
+
+  void Destroy() override {}
+
+  uint32_t GetLastError() override { return 0; }
+
+  std::string GetLastErrorAsString() override { return "SUCCESS"; }
+
+  std::string GetName() override { return "INCREMENTALGCEDITS"; }
+
+private:
+  eld::plugin::Section m_Main = eld::plugin::Section(nullptr);
+};
+
+std::unordered_map<std::string, Plugin *> Plugins;
+
+extern "C" {
+bool DLL_A_EXPORT RegisterAll() {
+  Plugins["INCREMENTALGCEDITS"] = new IncrementalGCEditsPlugin();
+  return true;
+}
+PluginBase DLL_A_EXPORT *getPlugin(const char *T) {
+  return Plugins[std::string(T)];
+}
+void DLL_A_EXPORT Cleanup() {
+  for (auto &A : Plugins)
+    delete A.second;
+  Plugins.clear();
+}
+}
@@ -0,0 +1,7 @@
+extern int bar(void);
+extern int data[];
+int *ptr = &data[1];
+
+int foo(void) { return bar() + *ptr; }
+
+int main(void) { return foo(); }
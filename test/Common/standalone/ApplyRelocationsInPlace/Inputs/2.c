@@ -0,0 +1,5 @@
+int data[] = {1, 2, 3};
+extern int foo(void);
+int (*fptr)(void) = foo;
+
+int bar(void) { return data[2]; }
@@ -0,0 +1,3 @@
+extern int a1();
+
+int main() { return a1(); }
@@ -0,0 +1,3 @@
+extern int b1();
+
+int a1() { return b1(); }
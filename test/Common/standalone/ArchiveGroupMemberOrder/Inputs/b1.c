@@ -0,0 +1,3 @@
+extern int a2();
+
+int b1() { return a2(); }
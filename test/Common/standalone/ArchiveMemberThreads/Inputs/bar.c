@@ -0,0 +1 @@
+const char *bar() { return "bar"; }
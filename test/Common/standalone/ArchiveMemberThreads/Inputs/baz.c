@@ -0,0 +1 @@
+const char *baz() { return "foo"; }
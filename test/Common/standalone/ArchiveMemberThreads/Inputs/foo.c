@@ -0,0 +1,4 @@
+extern const char *baz();
+
+const char *foo() { return "foo"; }
+const char *foobaz() { return baz(); }
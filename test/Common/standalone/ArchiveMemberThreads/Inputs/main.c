@@ -0,0 +1,4 @@
+extern const char *foo();
+extern const char *bar();
+
+int main() { return foo()[0] + bar()[0]; }
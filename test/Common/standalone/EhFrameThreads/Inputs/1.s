@@ -0,0 +1,17 @@
+	.section	.text.foo,"ax",%progbits
+	.globl	foo
+	.balign 4
+foo:
+	.cfi_startproc
+.Lfoo_end:
+	.size	foo, .Lfoo_end-foo
+	.cfi_endproc
+
+	.section	.text.unused1,"ax",%progbits
+	.globl	unused1
+	.balign 4
+unused1:
+	.cfi_startproc
+.Lunused1_end:
+	.size	unused1, .Lunused1_end-unused1
+	.cfi_endproc
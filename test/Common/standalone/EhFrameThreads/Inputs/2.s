@@ -0,0 +1,17 @@
+	.section	.text.bar,"ax",%progbits
+	.globl	bar
+	.balign 4
+bar:
+	.cfi_startproc
+.Lbar_end:
+	.size	bar, .Lbar_end-bar
+	.cfi_endproc
+
+	.section	.text.unused2,"ax",%progbits
+	.globl	unused2
+	.balign 4
+unused2:
+	.cfi_startproc
+.Lunused2_end:
+	.size	unused2, .Lunused2_end-unused2
+	.cfi_endproc
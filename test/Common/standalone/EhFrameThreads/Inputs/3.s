@@ -0,0 +1,18 @@
+# Each use of the macro adds two FDEs to .text.\name. The second FDE is empty
+# and starts where the next FDE of the section starts, so their PCs are the
+# same.
+	.macro fdes name
+	.section	.text.\name,"ax",%progbits
+	.cfi_startproc
+	.space	4
+	.cfi_endproc
+	.cfi_startproc
+	.cfi_endproc
+	.endm
+
+# The FDEs alternate between .text.odd and .text.even, and script.t places
+# .text.even after .text.odd, so the PCs are not sorted in .eh_frame.
+	.rept	256
+	fdes	odd
+	fdes	even
+	.endr
@@ -0,0 +1,7 @@
+SECTIONS {
+  . = . + SIZEOF_HEADERS;
+  .text : {
+    *(.text.odd)
+    *(.text.even)
+  }
+}
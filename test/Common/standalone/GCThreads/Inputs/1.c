@@ -0,0 +1,4 @@
+int bar();
+int baz();
+int unused1() { return baz(); }
+int main() { return bar(); }
@@ -0,0 +1,5 @@
+int data = 10;
+int unused_data = 20;
+int car() { return data; }
+int bar() { return car(); }
+int baz() { return unused_data; }
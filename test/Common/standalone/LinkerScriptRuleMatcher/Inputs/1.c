@@ -0,0 +1,5 @@
+__attribute__((section(".text.foo"))) int foo() { return 0; }
+__attribute__((section(".text.hot.a"))) int hot_a() { return 1; }
+__attribute__((section(".text.x1y"))) int x1y() { return 2; }
+__attribute__((section("table_end"))) int table_end = 3;
+int main() { return foo() + hot_a() + x1y(); }
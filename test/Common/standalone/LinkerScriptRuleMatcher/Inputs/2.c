@@ -0,0 +1,2 @@
+__attribute__((section(".text.foo"))) int bar() { return 4; }
+__attribute__((section(".text.cold"))) int cold() { return 5; }
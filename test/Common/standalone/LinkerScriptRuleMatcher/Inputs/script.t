@@ -0,0 +1,9 @@
+SECTIONS {
+  .foo : { *(EXCLUDE_FILE(*2.o) .text.foo) }
+  .hot : { *(.text.hot.*) }
+  .glob : { *(.text.x?y) }
+  .end : { *(*_end) }
+  .text : { *(.text*) }
+  .data : { *(.data*) }
+  .bss : { *(.bss*) }
+}
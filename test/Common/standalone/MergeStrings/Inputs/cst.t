@@ -0,0 +1,4 @@
+SECTIONS {
+  .rodata 0x1000 : { *(.rodata.cst*) }
+  .data : { *(.data) }
+}
@@ -0,0 +1,25 @@
+.section .rodata.cst8,"aM",%progbits,8
+.p2align 3
+.LA:
+.long 0x11111111
+.long 0x22222222
+.LB:
+.long 0x33333333
+.long 0x44444444
+
+.section .rodata.cst4,"aM",%progbits,4
+.p2align 2
+.LC:
+.long 0x33333333
+
+.data
+.p2align 2
+.globl a1
+a1:
+.long .LA
+.globl b1
+b1:
+.long .LB
+.globl c1
+c1:
+.long .LC
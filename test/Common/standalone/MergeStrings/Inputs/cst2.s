@@ -0,0 +1,23 @@
+.section .rodata.cst8,"aM",%progbits,8
+.p2align 3
+.LB:
+.long 0x33333333
+.long 0x44444444
+.LA:
+.long 0x11111111
+.long 0x22222222
+.LD:
+.long 0x55555555
+.long 0x66666666
+
+.data
+.p2align 2
+.globl a2
+a2:
+.long .LA
+.globl b2
+b2:
+.long .LB
+.globl d2
+d2:
+.long .LD
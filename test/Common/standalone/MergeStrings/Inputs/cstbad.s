@@ -0,0 +1,5 @@
+.section .rodata.cst8,"aM",%progbits,8
+.p2align 3
+.long 0x11111111
+.long 0x22222222
+.long 0x33333333
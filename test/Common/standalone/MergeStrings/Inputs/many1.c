@@ -0,0 +1,3 @@
+#include "manystrings.h"
+const char *const Strings1[] = {S6("")};
+int main() { return Strings1[0][0]; }
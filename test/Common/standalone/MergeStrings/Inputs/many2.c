@@ -0,0 +1,2 @@
+#include "manystrings.h"
+const char *const Strings2[] = {S6(""), S6("x")};
@@ -0,0 +1,6 @@
+#define S1(x) x "a", x "b", x "c", x "d"
+#define S2(x) S1(x "a"), S1(x "b"), S1(x "c"), S1(x "d")
+#define S3(x) S2(x "a"), S2(x "b"), S2(x "c"), S2(x "d")
+#define S4(x) S3(x "a"), S3(x "b"), S3(x "c"), S3(x "d")
+#define S5(x) S4(x "a"), S4(x "b"), S4(x "c"), S4(x "d")
+#define S6(x) S5(x "a"), S5(x "b"), S5(x "c"), S5(x "d")
@@ -0,0 +1,4 @@
+const char *str1 = "init_error";
+const char *str2 = "_error";
+const char *str3 = "error";
+const char *str4 = "init_done";
@@ -0,0 +1,2 @@
+__attribute__((weak)) int val = 1;
+int foo() { return val; }
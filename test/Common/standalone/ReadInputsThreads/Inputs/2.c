@@ -0,0 +1,2 @@
+__attribute__((weak)) int val = 2;
+int bar() { return val; }
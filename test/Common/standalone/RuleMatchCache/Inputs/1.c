@@ -0,0 +1,4 @@
+__attribute__((section(".text.foo"))) int foo() { return 0; }
+__attribute__((section(".text.hot.a"))) int hot_a() { return 1; }
+int data = 2;
+int main() { return foo() + hot_a() + data; }
@@ -0,0 +1,8 @@
+SECTIONS {
+  .foo : { *(.text.foo) }
+  .hot : { *(.text.hot.*) }
+  .text : { *(.text*) }
+  .data : { *(.data*) }
+  .bss : { *(.bss*) }
+  /DISCARD/ : { *(.comment) }
+}
@@ -0,0 +1,7 @@
+SECTIONS {
+  .hot : { *(.text.hot.* .text.foo) }
+  .text : { *(.text*) }
+  .data : { *(.data*) }
+  .bss : { *(.bss*) }
+  /DISCARD/ : { *(.comment) }
+}
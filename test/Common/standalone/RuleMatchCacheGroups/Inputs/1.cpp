@@ -0,0 +1,3 @@
+inline int dup() { return 1; }
+int one() { return dup(); }
+int main() { return one(); }
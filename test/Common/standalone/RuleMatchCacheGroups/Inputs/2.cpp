@@ -0,0 +1,2 @@
+inline int dup() { return 1; }
+int two() { return dup(); }
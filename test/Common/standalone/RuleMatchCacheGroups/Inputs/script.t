@@ -0,0 +1,6 @@
+SECTIONS {
+  .dup : { *(.text._Z3dupv) }
+  .text : { *(.text*) }
+  .data : { *(.data*) }
+  .bss : { *(.bss*) }
+}
@@ -0,0 +1,92 @@
+#include "LinkerPlugin.h"
+#include "LinkerPluginConfig.h"
+#include "LinkerWrapper.h"
+#include "PluginVersion.h"
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+class DLL_A_EXPORT ApplyRelocationsInPlaceUse
+    : public eld::plugin::LinkerPlugin {
+public:
+  ApplyRelocationsInPlaceUse()
+      : eld::plugin::LinkerPlugin("ApplyRelocationsInPlaceUse") {}
+
+  void addUse(eld::plugin::Use U) {
+    std::lock_guard<std::mutex> M(Mutex);
+    Uses.push_back(U);
+  }
+
+  // Relocations have been processed by now, but with
+  // --apply-relocations-in-place they are only applied while the output is
+  // written. Read the target data of the first use and replace the target
+  // data of the second one.
+  void ActBeforeWritingOutput() override {
+    auto NoteID = getLinker()->getNoteDiagID("Target data at offset %0: %1");
+    for (auto &U : Uses) {
+      uint64_t Data = 0;
+      if (U.getOffsetInChunk() == 0) {
+        eld::Expected<void> expGetTargetData =
+            getLinker()->getTargetDataForUse(U, Data);
+        ELDEXP_REPORT_AND_RETURN_VOID_IF_ERROR(getLinker(), expGetTargetData);
+        std::stringstream Ss;
+        Ss << std::hex << "0x" << Data;
+        getLinker()->reportDiag(NoteID, std::to_string(U.getOffsetInChunk()),
+                                Ss.str());
+      } else {
+        eld::Expected<void> expSetTargetData =
+            getLinker()->setTargetDataForUse(U, 0x12345678);
+        ELDEXP_REPORT_AND_RETURN_VOID_IF_ERROR(getLinker(), expSetTargetData);
+      }
+    }
+  }
+
+private:
+  std::mutex Mutex;
+  std::vector<eld::plugin::Use> Uses;
+};
+
+class DLL_A_EXPORT ApplyRelocationsInPlaceUseConfig
+    : public eld::plugin::LinkerPluginConfig {
+public:
+  ApplyRelocationsInPlaceUseConfig(ApplyRelocationsInPlaceUse &P)
+      : eld::plugin::LinkerPluginConfig(nullptr), P(P) {}
+
+  void Init() override {
+    eld::Expected<void> expRegReloc = P.getLinker()->registerReloc(
+        P.getLinker()->getRelocationHandler().getRelocationType("R_HEX_32"));
+    ELDEXP_REPORT_AND_RETURN_VOID_IF_ERROR(P.getLinker(), expRegReloc);
+  }
+
+  void RelocCallBack(eld::plugin::Use U) override { P.addUse(U); }
+
+private:
+  ApplyRelocationsInPlaceUse &P;
+};
+
+std::unique_ptr<ApplyRelocationsInPlaceUse> Plugin;
+std::unique_ptr<ApplyRelocationsInPlaceUseConfig> Config;
+
+extern "C" {
+bool DLL_A_EXPORT RegisterAll() {
+  if (!Plugin) {
+    Plugin = std::make_unique<ApplyRelocationsInPlaceUse>();
+    Config = std::make_unique<ApplyRelocationsInPlaceUseConfig>(*Plugin);
+  }
+  return true;
+}
+
+void DLL_A_EXPORT Cleanup() {
+  Config = nullptr;
+  Plugin = nullptr;
+}
+
+eld::plugin::PluginBase DLL_A_EXPORT *getPlugin(const char *T) {
+  return Plugin && Plugin->GetName() == T ? Plugin.get() : nullptr;
+}
+
+eld::plugin::LinkerPluginConfig DLL_A_EXPORT *getPluginConfig(const char *T) {
+  return Plugin && Plugin->GetName() == T ? Config.get() : nullptr;
+}
+}
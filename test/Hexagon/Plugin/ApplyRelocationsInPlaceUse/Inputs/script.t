@@ -0,0 +1,4 @@
+SECTIONS {
+  .text 0x1000 : { *(.text*) }
+  .data 0x2000 : { *(.data*) }
+}
@@ -0,0 +1,7 @@
+extern int bar(int);
+int data = 10;
+const char str[] = "incremental";
+
+int foo(int x) { return bar(x) + data + str[x]; }
+
+int main() { return foo(data); }
@@ -0,0 +1,3 @@
+int val = 20;
+
+int bar(int x) { return x + val; }
@@ -0,0 +1,7 @@
+extern int bar(int);
+extern int baz(int);
+int data = 10;
+
+int foo(int x) { return bar(x) + data; }
+
+int main() { return foo(data) + baz(data); }
@@ -0,0 +1,6 @@
+extern int foo(int);
+int val = 20;
+
+int bar(int x) { return x + val; }
+
+int baz(int x) { return foo(x) + bar(val); }
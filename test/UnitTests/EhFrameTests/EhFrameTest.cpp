@@ -0,0 +1,97 @@
+//===- EhFrameTest.cpp-----------------------------------------------------===//
+// Part of the eld Project, under the BSD License
+// See https://github.com/qualcomm/eld/LICENSE.txt for license information.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+#include "eld/Diagnostics/DiagnosticEngine.h"
+#include "eld/Fragment/EhFrameFragment.h"
+#include "eld/Fragment/FragmentRef.h"
+#include "eld/Fragment/RegionFragment.h"
+#include "eld/Readers/EhFrameSection.h"
+#include "eld/Readers/Relocation.h"
+#include "eld/Support/Memory.h"
+#include "llvm/BinaryFormat/ELF.h"
+#include "llvm/Support/Endian.h"
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace eld;
+
+namespace {
+constexpr size_t NumFDEs = 100000;
+constexpr size_t CIESize = 16;
+constexpr size_t FDESize = 24;
+// Offset of the PC begin field in an FDE.
+constexpr size_t PCBeginOffset = 8;
+
+size_t getFDEOffset(size_t I) { return CIESize + I * FDESize; }
+
+// Returns an .eh_frame section with one CIE, NumFDEs FDEs that refer to the
+// CIE, and the zero terminator.
+std::string createEhFrameContents() {
+  std::string Contents(getFDEOffset(NumFDEs) + 4, '\0');
+  uint8_t *Buf = reinterpret_cast<uint8_t *>(Contents.data());
+  llvm::support::endian::write32le(Buf, CIESize - 4);
+  for (size_t I = 0; I != NumFDEs; ++I) {
+    uint8_t *FDE = Buf + getFDEOffset(I);
+    llvm::support::endian::write32le(FDE, FDESize - 4);
+    llvm::support::endian::write32le(FDE + 4, getFDEOffset(I) + 4);
+  }
+  return Contents;
+}
+} // namespace
+
+/// Splits a synthetic .eh_frame section with 100k FDEs. The relocations are
+/// added in reverse order, so that assigning them to pieces requires sorting.
+TEST(EhFrameTest, SplitAndFindPieces) {
+  DiagnosticEngine *DiagEngine = make<DiagnosticEngine>(/*useColor=*/false);
+  std::string Contents = createEhFrameContents();
+  EhFrameSection *S = make<EhFrameSection>(
+      ".eh_frame", DiagEngine, llvm::ELF::SHT_PROGBITS, llvm::ELF::SHF_ALLOC,
+      /*EntSize=*/0, Contents.size());
+  RegionFragment *F = make<RegionFragment>(Contents, S, Fragment::Region);
+  S->addFragment(F);
+  for (size_t I = NumFDEs; I != 0; --I)
+    S->addRelocation(Relocation::Create(
+        /*Type=*/0, /*Size=*/0,
+        make<FragmentRef>(*F, getFDEOffset(I - 1) + PCBeginOffset)));
+
+  ASSERT_TRUE(S->splitEhFrameSection());
+  std::vector<EhFramePiece> &Pieces = S->getPieces();
+  ASSERT_EQ(Pieces.size(), NumFDEs + 2);
+  EXPECT_EQ(Pieces.front().getRelocation(), nullptr);
+  EXPECT_EQ(Pieces.back().getSize(), 4u);
+  for (size_t I = 0; I != NumFDEs; ++I) {
+    EhFramePiece &P = Pieces[I + 1];
+    ASSERT_EQ(P.getOffset(), getFDEOffset(I));
+    ASSERT_NE(P.getRelocation(), nullptr);
+    EXPECT_EQ(P.getRelocation()->getOffset(),
+              getFDEOffset(I) + PCBeginOffset);
+  }
+
+  EXPECT_EQ(S->findPiece(0), &Pieces.front());
+  EXPECT_EQ(S->findPiece(CIESize - 1), &Pieces.front());
+  for (size_t I = 0; I != NumFDEs; ++I) {
+    EXPECT_EQ(S->findPiece(getFDEOffset(I)), &Pieces[I + 1]);
+    EXPECT_EQ(S->findPiece(getFDEOffset(I) + FDESize - 1), &Pieces[I + 1]);
+  }
+  EXPECT_EQ(S->findPiece(Contents.size()), &Pieces.back());
+}
+
+/// A record that ends past the end of the section is recorded as the read
+/// error of the section, and is only raised by raiseReadError.
+TEST(EhFrameTest, RecordReadError) {
+  DiagnosticEngine *DiagEngine = make<DiagnosticEngine>(/*useColor=*/false);
+  std::string Contents(CIESize, '\0');
+  llvm::support::endian::write32le(reinterpret_cast<uint8_t *>(Contents.data()),
+                                   2 * CIESize);
+  EhFrameSection *S = make<EhFrameSection>(
+      ".eh_frame", DiagEngine, llvm::ELF::SHT_PROGBITS, llvm::ELF::SHF_ALLOC,
+      /*EntSize=*/0, Contents.size());
+  S->addFragment(make<RegionFragment>(Contents, S, Fragment::Region));
+
+  EXPECT_FALSE(S->hasReadError());
+  EXPECT_FALSE(S->splitEhFrameSection());
+  EXPECT_TRUE(S->hasReadError());
+  EXPECT_TRUE(S->getPieces().empty());
+}
@@ -0,0 +1,152 @@
+//===- RegionFragmentExTest.cpp--------------------------------------------===//
+// Part of the eld Project, under the BSD License
+// See https://github.com/qualcomm/eld/LICENSE.txt for license information.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+#include "eld/Fragment/FragmentRef.h"
+#include "eld/Fragment/RegionFragmentEx.h"
+#include "eld/Readers/ELFSection.h"
+#include "eld/Readers/Relocation.h"
+#include "eld/Support/Memory.h"
+#include "eld/SymbolResolver/LDSymbol.h"
+#include "eld/SymbolResolver/ResolveInfo.h"
+#include "llvm/BinaryFormat/ELF.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace eld;
+
+namespace {
+constexpr uint32_t RegionSize = 64;
+
+/// (offset, size) of a deletion, a symbol or a relocation, in the offsets of
+/// the region before any deletion.
+typedef std::pair<uint32_t, uint32_t> Range;
+
+/// A region of RegionSize bytes, each holding its own offset, with
+/// relocations and symbols.
+struct TestRegion {
+  TestRegion(const std::vector<uint32_t> &RelocOffsets,
+             const std::vector<Range> &SymbolRanges)
+      : Contents(RegionSize, '\0') {
+    for (uint32_t I = 0; I != RegionSize; ++I)
+      Contents[I] = static_cast<char>(I);
+    Section = make<ELFSection>(
+        LDFileFormat::Regular, ".text",
+        llvm::ELF::SHF_ALLOC | llvm::ELF::SHF_EXECINSTR, /*EntSize=*/0,
+        /*AddrAlign=*/1, llvm::ELF::SHT_PROGBITS, /*Info=*/0, /*Link=*/nullptr,
+        RegionSize, /*PAddr=*/0);
+    Region = make<RegionFragmentEx>(Contents.data(), Contents.size(), Section);
+    Section->addFragment(Region);
+    for (uint32_t Offset : RelocOffsets) {
+      Relocation *R = Relocation::Create(/*Type=*/0, /*Size=*/0,
+                                         FragmentRef(*Region, Offset));
+      Section->addRelocation(R);
+      Relocs.push_back(R);
+    }
+    for (const Range &S : SymbolRanges) {
+      ResolveInfo *Info = make<ResolveInfo>();
+      LDSymbol *Sym = make<LDSymbol>(Info);
+      Info->setOutSymbol(Sym);
+      Sym->setFragmentRef(make<FragmentRef>(*Region, S.first));
+      Sym->setSize(S.second);
+      Region->addSymbol(Info);
+      Symbols.push_back(Sym);
+    }
+  }
+
+  std::string Contents;
+  ELFSection *Section = nullptr;
+  RegionFragmentEx *Region = nullptr;
+  std::vector<Relocation *> Relocs;
+  std::vector<LDSymbol *> Symbols;
+};
+
+/// Deletes \p Deletions from one region with deleteInstruction, in offset
+/// order, and from another with addPendingDeletion, in the given order. The
+/// pending lookups must predict the sequential result, and both regions must
+/// be the same once the pending deletions are applied.
+void checkPendingDeletions(const std::vector<Range> &Deletions,
+                           const std::vector<uint32_t> &RelocOffsets,
+                           const std::vector<Range> &SymbolRanges) {
+  TestRegion Sequential(RelocOffsets, SymbolRanges);
+  std::vector<Range> Sorted = Deletions;
+  std::sort(Sorted.begin(), Sorted.end());
+  uint32_t Deleted = 0;
+  for (const Range &D : Sorted) {
+    Sequential.Region->deleteInstruction(D.first - Deleted, D.second);
+    Deleted += D.second;
+  }
+
+  TestRegion Pending(RelocOffsets, SymbolRanges);
+  for (const Range &D : Deletions)
+    Pending.Region->addPendingDeletion(D.first, D.second);
+  ASSERT_TRUE(Pending.Region->hasPendingDeletions());
+  EXPECT_EQ(Pending.Region->size(), Sequential.Region->size());
+  EXPECT_EQ(Pending.Region->getPendingDeletedBytes(0, RegionSize), Deleted);
+  for (size_t I = 0; I != RelocOffsets.size(); ++I) {
+    // Relocations at the end of the region are not moved.
+    if (RelocOffsets[I] < RegionSize)
+      EXPECT_EQ(Pending.Region->getRelaxedOffset(RelocOffsets[I]),
+                Sequential.Relocs[I]->targetRef()->offset());
+  }
+  for (size_t I = 0; I != SymbolRanges.size(); ++I) {
+    uint32_t Offset = SymbolRanges[I].first;
+    uint32_t Size = SymbolRanges[I].second;
+    EXPECT_EQ(Pending.Region->getRelaxedOffset(Offset),
+              Sequential.Symbols[I]->fragRef()->offset());
+    EXPECT_EQ(Size - Pending.Region->getPendingDeletedBytes(Offset,
+                                                            Offset + Size),
+              Sequential.Symbols[I]->size());
+  }
+
+  Pending.Region->applyPendingDeletions();
+  EXPECT_FALSE(Pending.Region->hasPendingDeletions());
+  EXPECT_EQ(Pending.Region->size(), RegionSize - Deleted);
+  EXPECT_EQ(Pending.Region->getRegion(), Sequential.Region->getRegion());
+  for (size_t I = 0; I != RelocOffsets.size(); ++I)
+    EXPECT_EQ(Pending.Relocs[I]->targetRef()->offset(),
+              Sequential.Relocs[I]->targetRef()->offset());
+  for (size_t I = 0; I != SymbolRanges.size(); ++I) {
+    EXPECT_EQ(Pending.Symbols[I]->fragRef()->offset(),
+              Sequential.Symbols[I]->fragRef()->offset());
+    EXPECT_EQ(Pending.Symbols[I]->size(), Sequential.Symbols[I]->size());
+  }
+}
+
+const std::vector<uint32_t> RelocOffsets = {0, 4, 6, 16, 20, 40, 48, 63};
+const std::vector<Range> SymbolRanges = {{0, 64}, {4, 12}, {20, 20}, {48, 16}};
+} // namespace
+
+TEST(RegionFragmentExTest, DeletionsInOrder) {
+  checkPendingDeletions({{4, 2}, {16, 4}, {40, 8}}, RelocOffsets, SymbolRanges);
+}
+
+/// Deletions recorded out of order are sorted by offset.
+TEST(RegionFragmentExTest, DeletionsOutOfOrder) {
+  checkPendingDeletions({{40, 8}, {4, 2}, {56, 2}, {16, 4}}, RelocOffsets,
+                        SymbolRanges);
+}
+
+/// A deletion at the start of a symbol shrinks the symbol without moving it,
+/// and a deletion at a relocation does not move the relocation.
+TEST(RegionFragmentExTest, DeletionAtSymbolStart) {
+  checkPendingDeletions({{4, 2}, {20, 4}, {48, 4}}, RelocOffsets,
+                        SymbolRanges);
+}
+
+/// A symbol with several deletions inside it shrinks by all of them.
+TEST(RegionFragmentExTest, SymbolSpanningDeletions) {
+  checkPendingDeletions({{22, 2}, {26, 4}, {32, 2}, {38, 2}}, RelocOffsets,
+                        SymbolRanges);
+}
+
+/// Symbols at the end of the region move with deletions, while relocations
+/// at the end of the region do not.
+TEST(RegionFragmentExTest, RelocationsAndSymbolsAtSize) {
+  checkPendingDeletions({{8, 4}, {60, 4}}, {8, 60, RegionSize},
+                        {{60, 4}, {RegionSize, 0}});
+}
@@ -0,0 +1,60 @@
+//===- RelocationTableTest.cpp---------------------------------------------===//
+// Part of the eld Project, under the BSD License
+// See https://github.com/qualcomm/eld/LICENSE.txt for license information.
+// SPDX-License-Identifier: BSD-3-Clause
+//===----------------------------------------------------------------------===//
+#include "eld/Target/RelocationTable.h"
+#include "llvm/Support/Endian.h"
+#include <gtest/gtest.h>
+#include <array>
+#include <utility>
+
+using namespace eld;
+
+namespace {
+typedef uint64_t (*ApplyFunctionType)(uint8_t *Buf, uint64_t Addend);
+
+uint64_t applyNone(uint8_t *, uint64_t) { return 0; }
+
+uint64_t applyAbs32(uint8_t *Buf, uint64_t Addend) {
+  uint32_t V = llvm::support::endian::read32le(Buf) + Addend;
+  llvm::support::endian::write32le(Buf, V);
+  return V;
+}
+
+uint64_t applyAbs64(uint8_t *Buf, uint64_t Addend) {
+  uint64_t V = llvm::support::endian::read64le(Buf) + Addend;
+  llvm::support::endian::write64le(Buf, V);
+  return V;
+}
+
+uint64_t applyBranch(uint8_t *Buf, uint64_t Addend) {
+  uint32_t V = (llvm::support::endian::read32le(Buf) & 0xfc000000) |
+               ((Addend >> 2) & 0x03ffffff);
+  llvm::support::endian::write32le(Buf, V);
+  return V;
+}
+
+struct ApplyFunctionEntry {
+  ApplyFunctionType func = nullptr;
+  const char *name = nullptr;
+  size_t size = 0;
+};
+typedef std::pair<uint32_t, ApplyFunctionEntry> ApplyFunctionListEntry;
+} // namespace
+
+TEST(RelocationTableTest, CreateTable) {
+  static constexpr ApplyFunctionListEntry List[] = {
+      {0x0, {&applyNone, "NONE", 0}},
+      {0x101, {&applyAbs64, "ABS64", 64}},
+      {0x102, {&applyAbs32, "ABS32", 32}},
+      {1033, {&applyBranch, "LAST", 32}}};
+  static constexpr std::array<ApplyFunctionEntry, 1034> Table =
+      createRelocationTable<ApplyFunctionEntry, 1034>(List);
+  static_assert(Table[0x101].size == 64);
+  static_assert(Table[0x103].func == nullptr);
+  EXPECT_EQ(Table[0x0].func, &applyNone);
+  EXPECT_STREQ(Table[0x102].name, "ABS32");
+  EXPECT_EQ(Table[1033].func, &applyBranch);
+  EXPECT_EQ(Table[0x100].name, nullptr);
+}
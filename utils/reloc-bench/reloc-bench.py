@@ -0,0 +1,196 @@
+#!/usr/bin/env python3
+
+# Links generated relocatable objects with many relocations and reports the
+# time the linker spends in its "Apply Relocation" phase, that is, in the
+# Relocator::applyRelocation calls of each target. See README.md.
+
+import argparse
+import os
+import re
+import shutil
+import subprocess
+import sys
+
+# Relocation types applied by the benchmark for each target. Only types that
+# can be resolved statically against a local symbol in the same section are
+# used, so the link needs no GOT, PLT or dynamic relocations.
+ARCH = {
+    "aarch64": {
+        "mach": "EM_AARCH64",
+        "bits": 64,
+        "rel": "rela",
+        "relocs": [
+            "R_AARCH64_ABS64",
+            "R_AARCH64_ABS32",
+            "R_AARCH64_PREL32",
+            "R_AARCH64_CALL26",
+            "R_AARCH64_ADD_ABS_LO12_NC",
+        ],
+    },
+    "arm": {
+        "mach": "EM_ARM",
+        "bits": 32,
+        "rel": "rel",
+        "relocs": ["R_ARM_ABS32", "R_ARM_REL32", "R_ARM_CALL"],
+    },
+    "hexagon": {
+        "mach": "EM_HEXAGON",
+        "bits": 32,
+        "rel": "rela",
+        "relocs": ["R_HEX_32", "R_HEX_B22_PCREL", "R_HEX_LO16"],
+    },
+    "riscv64": {
+        "mach": "EM_RISCV",
+        "bits": 64,
+        "rel": "rela",
+        "relocs": [
+            "R_RISCV_64",
+            "R_RISCV_32",
+            "R_RISCV_JAL",
+            "R_RISCV_HI20",
+            "R_RISCV_LO12_I",
+        ],
+    },
+    "x86_64": {
+        "mach": "EM_X86_64",
+        "bits": 64,
+        "rel": "rela",
+        "relocs": ["R_X86_64_64", "R_X86_64_32", "R_X86_64_PC32"],
+    },
+}
+
+# Each relocation patches its own 8-byte slot. Objects are kept small enough
+# for PC-relative branches to reach the start of their section.
+SLOT_SIZE = 8
+RELOCS_PER_OBJECT = 65536
+TIMER_NAME = "Apply Relocation"
+
+
+def write_object_yaml(f, arch, num_relocs):
+    rel = arch["rel"]
+    f.write("--- !ELF\n")
+    f.write("FileHeader:\n")
+    f.write(f"  Class: ELFCLASS{arch['bits']}\n")
+    f.write("  Data: ELFDATA2LSB\n")
+    f.write("  Type: ET_REL\n")
+    f.write(f"  Machine: {arch['mach']}\n")
+    f.write("Sections:\n")
+    f.write("  - Name: .text\n")
+    f.write("    Type: SHT_PROGBITS\n")
+    f.write("    Flags: [ SHF_ALLOC, SHF_EXECINSTR ]\n")
+    f.write("    AddressAlign: 8\n")
+    f.write(f"    Size: {num_relocs * SLOT_SIZE}\n")
+    f.write(f"  - Name: .{rel}.text\n")
+    f.write(f"    Type: SHT_{rel.upper()}\n")
+    f.write("    Flags: [ SHF_INFO_LINK ]\n")
+    f.write("    Link: .symtab\n")
+    f.write("    Info: .text\n")
+    f.write("    Relocations:\n")
+    relocs = arch["relocs"]
+    for i in range(num_relocs):
+        f.write(f"      - Offset: {i * SLOT_SIZE}\n")
+        f.write("        Symbol: target\n")
+        f.write(f"        Type: {relocs[i % len(relocs)]}\n")
+    f.write("Symbols:\n")
+    f.write("  - Name: target\n")
+    f.write("    Type: STT_FUNC\n")
+    f.write("    Section: .text\n")
+    f.write("...\n")
+
+
+def create_objects(args, name, arch):
+    # Only one object is generated per relocation count. Its symbol is local,
+    # so the inputs are copies of it, which keeps generating 10M relocations
+    # cheap.
+    objects = []
+    remaining = args.relocs
+    index = 0
+    while remaining > 0:
+        count = min(remaining, RELOCS_PER_OBJECT)
+        template = os.path.join(args.output_dir, f"{name}.{count}.template.o")
+        if not os.path.exists(template):
+            yaml_file = os.path.join(args.output_dir, f"{name}.{count}.yaml")
+            with open(yaml_file, "w") as f:
+                write_object_yaml(f, arch, count)
+            subprocess.check_call([args.yaml2obj, yaml_file, "-o", template])
+        obj = os.path.join(args.output_dir, f"{name}.{index}.o")
+        if not os.path.exists(obj):
+            shutil.copyfile(template, obj)
+        objects.append(obj)
+        remaining -= count
+        index += 1
+    return objects
+
+
+def parse_wall_time(output):
+    # The timer report ends each line with the wall time before the name.
+    for line in output.splitlines():
+        if line.rstrip().endswith(TIMER_NAME):
+            times = re.findall(r"(\d+\.\d+) \(", line)
+            if times:
+                return float(times[-1])
+    return None
+
+
+def run(args, name, objects):
+    out = os.path.join(args.output_dir, f"{name}.out")
+    cmd = [args.ld, "-static", "-o", out, "--print-timing-stats"]
+    cmd += args.ld_option + objects
+    best = None
+    for _ in range(args.repeat):
+        ret = subprocess.run(cmd,
+                             stdout=subprocess.PIPE,
+                             stderr=subprocess.STDOUT,
+                             universal_newlines=True)
+        if ret.returncode != 0:
+            sys.stderr.write(f"{name}: link failed\n{ret.stdout}")
+            return None
+        seconds = parse_wall_time(ret.stdout)
+        if seconds is None:
+            sys.stderr.write(f"{name}: no '{TIMER_NAME}' timer in output\n")
+            return None
+        best = seconds if best is None else min(best, seconds)
+    return best
+
+
+def create_argparser():
+    argparser = argparse.ArgumentParser()
+    argparser.add_argument("--arch",
+                           action="append",
+                           choices=sorted(ARCH),
+                           help="target to benchmark, default: all")
+    argparser.add_argument("--ld", required=True, help="path to ld.eld")
+    argparser.add_argument("--yaml2obj",
+                           default="yaml2obj",
+                           help="path to yaml2obj")
+    argparser.add_argument("--output-dir",
+                           required=True,
+                           help="directory for the generated files")
+    argparser.add_argument("--relocs",
+                           type=int,
+                           default=10000000,
+                           help="number of relocations per target")
+    argparser.add_argument("--repeat",
+                           type=int,
+                           default=3,
+                           help="number of links per target, the best is "
+                           "reported")
+    argparser.add_argument("--ld-option",
+                           action="append",
+                           default=[],
+                           help="extra linker option, may be repeated")
+    return argparser
+
+
+args = create_argparser().parse_args()
+os.makedirs(args.output_dir, exist_ok=True)
+failed = False
+for name in args.arch or sorted(ARCH):
+    objects = create_objects(args, name, ARCH[name])
+    seconds = run(args, name, objects)
+    if seconds is None:
+        failed = True
+        continue
+    print(f"{name}: {args.relocs} relocations, {TIMER_NAME} "
+          f"{seconds:.3f}s")
+sys.exit(1 if failed else 0)